@@ -195,6 +195,57 @@ struct RunResult futureLatency(struct ResultSet* rs, FDBTransaction* tr) {
 	return RES(FUTURE_LATENCY_COUNT / (end - start), 0);
 }
 
+#define CONCURRENT_FUTURE_THREADS 16
+const char* CONCURRENT_FUTURE_LATENCY_KPI = "C concurrent future throughput (local client)";
+
+struct ConcurrentFutureArgs {
+	struct ResultSet* rs;
+	FDBDatabase* db;
+	fdb_error_t e;
+};
+
+// Each thread waits on FUTURE_LATENCY_COUNT / CONCURRENT_FUTURE_THREADS cached read versions from its own transaction,
+// so the run measures how well the handoff to and from the network thread scales with the number of client threads.
+void* concurrentFutureThread(void* arg) {
+	struct ConcurrentFutureArgs* args = (struct ConcurrentFutureArgs*)arg;
+	FDBTransaction* tr = NULL;
+	args->e = maybeLogError(fdb_database_create_transaction(args->db, &tr), "create transaction", args->rs);
+	int i;
+	for (i = 0; !args->e && i < FUTURE_LATENCY_COUNT / CONCURRENT_FUTURE_THREADS; i++) {
+		FDBFuture* f = fdb_transaction_get_read_version(tr);
+		args->e = maybeLogError(waitError(f), "getting read version", args->rs);
+		fdb_future_destroy(f);
+	}
+	if (tr) {
+		fdb_transaction_destroy(tr);
+	}
+	return NULL;
+}
+
+struct RunResult concurrentFutureLatency(struct ResultSet* rs, FDBDatabase* db) {
+	pthread_t threads[CONCURRENT_FUTURE_THREADS];
+	struct ConcurrentFutureArgs args[CONCURRENT_FUTURE_THREADS];
+
+	double start = getTime();
+	int i;
+	for (i = 0; i < CONCURRENT_FUTURE_THREADS; i++) {
+		args[i] = (struct ConcurrentFutureArgs){ rs, db, 0 };
+		checkError(pthread_create(&threads[i], NULL, &concurrentFutureThread, &args[i]), "starting thread", rs);
+	}
+	fdb_error_t e = 0;
+	for (i = 0; i < CONCURRENT_FUTURE_THREADS; i++) {
+		checkError(pthread_join(threads[i], NULL), "joining thread", rs);
+		if (args[i].e && !e) {
+			e = args[i].e;
+		}
+	}
+	double end = getTime();
+	if (e)
+		return RES(0, e);
+
+	return RES(FUTURE_LATENCY_COUNT / (end - start), 0);
+}
+
 uint32_t CLEAR_COUNT = 100000;
 const char* CLEAR_KPI = "C clear throughput (local client)";
 struct RunResult clear(struct ResultSet* rs, FDBTransaction* tr) {
@@ -604,6 +655,9 @@ void runTests(struct ResultSet* rs) {
 	printf("future_latency\n");
 	runTest(&futureLatency, db, rs, FUTURE_LATENCY_KPI);
 
+	printf("concurrent_future_latency\n");
+	runTestDb(&concurrentFutureLatency, db, rs, CONCURRENT_FUTURE_LATENCY_KPI);
+
 	printf("clear\n");
 	runTest(&clear, db, rs, CLEAR_KPI);
 
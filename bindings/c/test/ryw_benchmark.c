@@ -255,6 +255,23 @@ int interleavedSetsGets(FDBTransaction* tr, struct ResultSet* rs) {
 	return 10000 / (end - start);
 }
 
+int blindSets(FDBTransaction* tr, struct ResultSet* rs) {
+	int i;
+	uint8_t* v = (uint8_t*)"bar";
+
+	fdb_transaction_reset(tr);
+
+	double start = getTime();
+	for (i = 0; i < numKeys; ++i) {
+		fdb_transaction_set(tr, keys[i], keySize, v, 3);
+	}
+	double end = getTime();
+
+	fdb_transaction_reset(tr);
+	insertData(tr);
+	return numKeys / (end - start);
+}
+
 void runTests(struct ResultSet* rs) {
 	FDBDatabase* db = openDatabase(rs, &netThread);
 
@@ -276,6 +293,7 @@ void runTests(struct ResultSet* rs) {
 	runTest(&singleClearGetRange, tr, rs, "C: get range cached values with clears throughput");
 	runTest(&clearRangeGetRange, tr, rs, "C: get range cached values with clear ranges throughput");
 	runTest(&interleavedSetsGets, tr, rs, "C: interleaved sets and gets on a single key throughput");
+	runTest(&blindSets, tr, rs, "C: blind sets in a write-only transaction throughput");
 
 	fdb_transaction_destroy(tr);
 	fdb_database_destroy(db);
@@ -20,6 +20,7 @@
 package com.apple.foundationdb;
 
 import java.util.Iterator;
+import java.util.List;
 import java.util.Map;
 import java.util.NavigableMap;
 import java.util.Random;
@@ -186,4 +187,45 @@ class RangeQueryIntegrationTest {
 			});
 		}
 	}
+
+	@Test
+	void parallelRangeQueryOverMultipleChunks() throws Exception {
+		/*
+		 * Make sure that a range read as several chunks, some of them several batches long, returns
+		 * the same rows in the same order as a plain range read
+		 */
+		int numRows = 2000;
+		byte[] value = new byte[100];
+		try (Database db = fdb.open()) {
+			for (int i = 0; i < numRows; i += 200) {
+				final int first = i;
+				db.run(tr -> {
+					for (int j = first; j < first + 200; j++) {
+						tr.set(String.format("parallel%06d", j).getBytes(), value);
+					}
+					return null;
+				});
+			}
+
+			for (long chunkSize : new long[] { 10000, 10000000 }) {
+				db.run(tr -> {
+					List<KeyValue> expected = tr.getRange("parallel".getBytes(), "parallem".getBytes()).asList().join();
+					List<KeyValue> actual =
+					    tr.getRangeParallel("parallel".getBytes(), "parallem".getBytes(), chunkSize, 4).asList().join();
+					Assertions.assertEquals(numRows, expected.size(), "Incorrect number of KeyValues returned");
+					Assertions.assertEquals(expected, actual, "Parallel range read returned different rows");
+
+					Iterator<KeyValue> kvs =
+					    tr.getRangeParallel("parallel".getBytes(), "parallem".getBytes(), chunkSize, 1).iterator();
+					for (KeyValue kv : expected) {
+						Assertions.assertTrue(kvs.hasNext(), "iterator ended too early");
+						Assertions.assertEquals(kv, kvs.next(), "Incorrect KeyValue!");
+					}
+					Assertions.assertFalse(kvs.hasNext(), "Iterator returned too much data");
+
+					return null;
+				});
+			}
+		}
+	}
 }
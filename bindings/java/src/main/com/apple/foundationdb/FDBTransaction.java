@@ -91,6 +91,16 @@ class FDBTransaction extends NativeObjectWrapper implements Transaction, OptionC
 			return FDBTransaction.this.getRangeSplitPoints(range, chunkSize);
 		}
 
+		@Override
+		public AsyncIterable<KeyValue> getRangeParallel(byte[] begin, byte[] end, long chunkSize, int concurrency) {
+			return new ParallelRangeQuery(this, begin, end, chunkSize, concurrency);
+		}
+
+		@Override
+		public AsyncIterable<KeyValue> getRangeParallel(Range range, long chunkSize, int concurrency) {
+			return getRangeParallel(range.begin, range.end, chunkSize, concurrency);
+		}
+
 		@Override
 		public AsyncIterable<MappedKeyValue> getMappedRange(KeySelector begin, KeySelector end, byte[] mapper,
 		                                                        int limit, boolean reverse, StreamingMode mode) {
@@ -345,6 +355,16 @@ class FDBTransaction extends NativeObjectWrapper implements Transaction, OptionC
 		return this.getRangeSplitPoints(range.begin, range.end, chunkSize);
 	}
 
+	@Override
+	public AsyncIterable<KeyValue> getRangeParallel(byte[] begin, byte[] end, long chunkSize, int concurrency) {
+		return new ParallelRangeQuery(this, begin, end, chunkSize, concurrency);
+	}
+
+	@Override
+	public AsyncIterable<KeyValue> getRangeParallel(Range range, long chunkSize, int concurrency) {
+		return this.getRangeParallel(range.begin, range.end, chunkSize, concurrency);
+	}
+
 	@Override
 	public AsyncIterable<MappedKeyValue> getMappedRange(KeySelector begin, KeySelector end, byte[] mapper,
 	                                                        int limit, boolean reverse, StreamingMode mode) {
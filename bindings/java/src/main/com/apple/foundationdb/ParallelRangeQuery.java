@@ -0,0 +1,175 @@
+/*
+ * ParallelRangeQuery.java
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.apple.foundationdb;
+
+import java.util.ArrayDeque;
+import java.util.Iterator;
+import java.util.List;
+import java.util.NoSuchElementException;
+import java.util.concurrent.CompletableFuture;
+
+import com.apple.foundationdb.async.AsyncIterable;
+import com.apple.foundationdb.async.AsyncIterator;
+import com.apple.foundationdb.async.AsyncUtil;
+
+/**
+ * Represents a query against FoundationDB for a range of keys that is read as several
+ *  concurrent range reads. The range is split into chunks of roughly {@code chunkSize}
+ *  bytes with {@link ReadTransaction#getRangeSplitPoints(byte[], byte[], long)}, which
+ *  also splits at shard boundaries, so chunks of different shards are read from different
+ *  storage servers. Up to {@code concurrency} chunks are read ahead of the one being
+ *  iterated over, and results are returned in key order.
+ */
+class ParallelRangeQuery implements AsyncIterable<KeyValue> {
+	private final ReadTransaction tr;
+	private final byte[] begin;
+	private final byte[] end;
+	private final long chunkSize;
+	private final int concurrency;
+
+	ParallelRangeQuery(ReadTransaction transaction, byte[] begin, byte[] end, long chunkSize, int concurrency) {
+		if(chunkSize <= 0) {
+			throw new IllegalArgumentException("chunkSize must be positive");
+		}
+		if(concurrency <= 0) {
+			throw new IllegalArgumentException("concurrency must be positive");
+		}
+		this.tr = transaction;
+		this.begin = begin;
+		this.end = end;
+		this.chunkSize = chunkSize;
+		this.concurrency = concurrency;
+	}
+
+	/**
+	 * Returns all the results from the range requested as a {@code List}. The whole
+	 *  range is held in memory, so this should only be used for ranges known to be small.
+	 *
+	 * @return a {@code CompletableFuture} that will be set to the contents of the database
+	 *  constrained by the query parameters.
+	 */
+	@Override
+	public CompletableFuture<List<KeyValue>> asList() {
+		return AsyncUtil.collect(this, tr.getExecutor());
+	}
+
+	/**
+	 * Returns an {@code Iterator} over the results of this query against FoundationDB.
+	 *
+	 * @return an {@code Iterator} over type {@code KeyValue}.
+	 */
+	@Override
+	public AsyncIterator<KeyValue> iterator() {
+		return new AsyncParallelRangeIterator();
+	}
+
+	private class AsyncParallelRangeIterator implements AsyncIterator<KeyValue> {
+		private final CompletableFuture<KeyArrayResult> splitPoints;
+		private final ArrayDeque<CompletableFuture<List<KeyValue>>> pending = new ArrayDeque<>();
+		private List<byte[]> boundaries;
+		private int nextChunk = 0;
+		private Iterator<KeyValue> current;
+		private CompletableFuture<Boolean> nextFuture;
+		private boolean cancelled = false;
+
+		private AsyncParallelRangeIterator() {
+			splitPoints = tr.getRangeSplitPoints(begin, end, chunkSize);
+		}
+
+		// Starts reads of the chunks that follow the ones already read or in flight, up to the concurrency limit. Must be
+		// called with the lock held.
+		private void startReads() {
+			while(!cancelled && pending.size() < concurrency && nextChunk + 1 < boundaries.size()) {
+				byte[] chunkBegin = boundaries.get(nextChunk);
+				byte[] chunkEnd = boundaries.get(nextChunk + 1);
+				pending.add(tr.getRange(chunkBegin, chunkEnd, ReadTransaction.ROW_LIMIT_UNLIMITED, false,
+				                        StreamingMode.WANT_ALL).asList());
+				++nextChunk;
+			}
+		}
+
+		// Waits for the next chunk with any results, and returns whether there was one
+		private CompletableFuture<Boolean> readNextChunk() {
+			CompletableFuture<List<KeyValue>> chunk;
+			synchronized(this) {
+				startReads();
+				chunk = pending.poll();
+			}
+			if(chunk == null) {
+				return AsyncUtil.READY_FALSE;
+			}
+			return chunk.thenCompose(kvs -> {
+				synchronized(AsyncParallelRangeIterator.this) {
+					current = kvs.iterator();
+					startReads();
+					if(current.hasNext()) {
+						return AsyncUtil.READY_TRUE;
+					}
+				}
+				return readNextChunk();
+			});
+		}
+
+		@Override
+		public synchronized CompletableFuture<Boolean> onHasNext() {
+			if(current != null && current.hasNext()) {
+				return AsyncUtil.READY_TRUE;
+			}
+			if(nextFuture == null || nextFuture.isDone()) {
+				nextFuture = splitPoints.thenCompose(result -> {
+					synchronized(AsyncParallelRangeIterator.this) {
+						if(boundaries == null) {
+							boundaries = result.keys;
+						}
+					}
+					return readNextChunk();
+				});
+			}
+			return nextFuture;
+		}
+
+		@Override
+		public boolean hasNext() {
+			return onHasNext().join();
+		}
+
+		// Not synchronized, as hasNext() may block on a callback that takes the lock
+		@Override
+		public KeyValue next() {
+			if(!hasNext()) {
+				throw new NoSuchElementException();
+			}
+			synchronized(this) {
+				return current.next();
+			}
+		}
+
+		@Override
+		public synchronized void cancel() {
+			cancelled = true;
+			splitPoints.cancel(true);
+			for(CompletableFuture<List<KeyValue>> chunk : pending) {
+				chunk.cancel(true);
+			}
+			pending.clear();
+		}
+	}
+}
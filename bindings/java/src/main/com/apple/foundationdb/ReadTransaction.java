@@ -511,6 +511,35 @@ public interface ReadTransaction extends ReadTransactionContext {
 	 */
 	CompletableFuture<KeyArrayResult> getRangeSplitPoints(Range range, long chunkSize);
 
+	/**
+	 * Gets an ordered range of keys and values from the database by reading several parts of
+	 *  the range at once. The range is split into chunks of (roughly) <code>chunkSize</code> bytes
+	 *  and at shard boundaries with {@link #getRangeSplitPoints(byte[], byte[], long)}, and up to
+	 *  <code>concurrency</code> chunks are read ahead of the one being iterated over. Results are
+	 *  returned in key order, and at most <code>concurrency + 1</code> chunks are held in memory. This is intended for
+	 *  scans of large ranges, where reading one shard at a time limits throughput.
+	 *
+	 * @param begin the beginning of the range (inclusive)
+	 * @param end the end of the range (exclusive)
+	 * @param chunkSize the approximate number of bytes read by each request
+	 * @param concurrency the maximum number of chunks read ahead
+	 *
+	 * @return a handle to access the results of the asynchronous call
+	 */
+	AsyncIterable<KeyValue> getRangeParallel(byte[] begin, byte[] end, long chunkSize, int concurrency);
+
+	/**
+	 * Gets an ordered range of keys and values from the database by reading several parts of
+	 *  the range at once. See {@link #getRangeParallel(byte[], byte[], long, int)}.
+	 *
+	 * @param range the range of the keys
+	 * @param chunkSize the approximate number of bytes read by each request
+	 * @param concurrency the maximum number of chunks read ahead
+	 *
+	 * @return a handle to access the results of the asynchronous call
+	 */
+	AsyncIterable<KeyValue> getRangeParallel(Range range, long chunkSize, int concurrency);
+
 	
 	/**
 	 * Returns a set of options that can be set on a {@code Transaction}
@@ -20,6 +20,7 @@
 
 # FoundationDB Python API
 
+import collections
 import ctypes
 import ctypes.util
 import datetime
@@ -406,6 +407,88 @@ class FDBRange(object):
             yield result
 
 
+class _FDBRangeChunk(object):
+    """Reads all of a range in the background. Each batch is requested from the
+    callback of the one before it, so the whole chunk is read without waiting for
+    the caller to iterate over it.
+
+    """
+
+    def __init__(self, tr, begin, end):
+        self._tr = tr
+        self._end = KeySelector.first_greater_or_equal(end)
+        self._results = []
+        self._error = None
+        self._cancelled = False
+        self._done = threading.Event()
+        self._future = None
+        self._read(KeySelector.first_greater_or_equal(begin), 1)
+
+    def _read(self, bsel, iteration):
+        self._future = self._tr._get_range(bsel, self._end, 0, StreamingMode.want_all, iteration, False)
+        self._future.on_ready(lambda f: self._on_batch(f, iteration))
+
+    def _on_batch(self, future, iteration):
+        try:
+            (kvs, count, more) = future.wait()
+            self._results.extend(kvs)
+            if more and count and not self._cancelled:
+                self._read(KeySelector.first_greater_than(kvs[-1].key), iteration + 1)
+                return
+        except BaseException as e:
+            self._error = e
+        self._done.set()
+
+    def cancel(self):
+        self._cancelled = True
+        self._future.cancel()
+
+    def wait(self):
+        self._done.wait()
+        if self._error is not None:
+            raise self._error
+        return self._results
+
+
+class FDBParallelRange(object):
+    """Iterates over the results of an FDB range query that is split into
+    chunks with get_range_split_points. Up to concurrency chunks are read in
+    full ahead of the one being iterated over. Returns KeyValue objects in key
+    order.
+
+    """
+
+    def __init__(self, tr, begin, end, chunk_size, concurrency):
+        self._tr = tr
+        self._concurrency = concurrency
+        self._split_points = tr.get_range_split_points(begin, end, chunk_size)
+
+    def to_list(self):
+        return list(self)
+
+    def __iter__(self):
+        boundaries = self._split_points.wait()
+        pending = collections.deque()
+        next_chunk = [0]
+
+        def start_reads():
+            while len(pending) < self._concurrency and next_chunk[0] + 1 < len(boundaries):
+                pending.append(_FDBRangeChunk(self._tr, boundaries[next_chunk[0]], boundaries[next_chunk[0] + 1]))
+                next_chunk[0] += 1
+
+        try:
+            start_reads()
+            while pending:
+                chunk = pending.popleft()
+                start_reads()
+                for result in chunk.wait():
+                    yield result
+        finally:
+            # Stop reading ahead if the caller stops iterating early
+            for chunk in pending:
+                chunk.cancel()
+
+
 class TransactionRead(_FDBBase):
     def __init__(self, tpointer, db, snapshot):
         self.tpointer = tpointer
@@ -488,6 +571,11 @@ class TransactionRead(_FDBBase):
             chunk_size
             ))
 
+    def get_range_parallel(self, begin_key, end_key, chunk_size=10000000, concurrency=8):
+        if begin_key is None or end_key is None or chunk_size <= 0 or concurrency <= 0:
+            raise Exception('Invalid begin key, end key, chunk size or concurrency')
+        return FDBParallelRange(self, keyToBytes(begin_key), keyToBytes(end_key), chunk_size, concurrency)
+
 class Transaction(TransactionRead):
     """A modifiable snapshot of a Database.
 
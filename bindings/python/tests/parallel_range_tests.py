@@ -0,0 +1,75 @@
+#!/usr/bin/python
+#
+# parallel_range_tests.py
+#
+# This source file is part of the FoundationDB open source project
+#
+# Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+import fdb
+import sys
+
+if __name__ == '__main__':
+    fdb.api_version(720)
+
+prefix = b'parallel_range_tests/'
+
+@fdb.transactional
+def load_rows(tr, begin, end):
+    for i in range(begin, end):
+        tr[prefix + b'%06d' % i] = b'v' * 100
+
+@fdb.transactional
+def check_parallel_range(tr, chunk_size, concurrency):
+    expected = tr.get_range(prefix, prefix + b'\xff').to_list()
+    actual = tr.get_range_parallel(prefix, prefix + b'\xff', chunk_size, concurrency).to_list()
+    assert [(kv.key, kv.value) for kv in actual] == [(kv.key, kv.value) for kv in expected]
+
+@fdb.transactional
+def check_early_stop(tr):
+    # Abandoning the iteration part way through cancels the chunks read ahead
+    it = iter(tr.get_range_parallel(prefix, prefix + b'\xff', 10000, 4))
+    first = next(it)
+    assert first.key == prefix + b'%06d' % 0
+    it.close()
+    assert tr[prefix + b'%06d' % 1] == b'v' * 100
+
+@fdb.transactional
+def check_empty_range(tr):
+    assert tr.get_range_parallel(prefix + b'\x00', prefix + b'\x01', 10000, 4).to_list() == []
+
+def test_get_range_parallel(db):
+    del db[prefix : prefix + b'\xff']
+    # Rows are loaded in several transactions to stay within the transaction size limit
+    for begin in range(0, 2000, 200):
+        load_rows(db, begin, begin + 200)
+
+    # Small chunks are read several at a time, and a single large chunk takes several batches
+    check_parallel_range(db, 10000, 4)
+    check_parallel_range(db, 100000, 1)
+    check_parallel_range(db, 10000000, 8)
+    check_early_stop(db)
+    check_empty_range(db)
+
+    del db[prefix : prefix + b'\xff']
+
+# Expect a cluster file as input. This test will write to the FDB cluster, so
+# be aware of potential side effects.
+if __name__ == '__main__':
+    clusterFile = sys.argv[1]
+    db = fdb.open(clusterFile)
+    db.options.set_transaction_timeout(2000)  # 2 seconds
+    db.options.set_transaction_retry_limit(3)
+    test_get_range_parallel(db)
@@ -49,6 +49,7 @@ from cancellation_timeout_tests import test_db_retry_limits
 from cancellation_timeout_tests import test_combinations
 
 from size_limit_tests import test_size_limit_option, test_get_approximate_size
+from parallel_range_tests import test_get_range_parallel
 from tenant_tests import test_tenants
 
 random.seed(0)
@@ -617,6 +618,7 @@ class Tester:
                         test_combinations(db)
                         test_locality(db)
                         test_predicates()
+                        test_get_range_parallel(db)
 
                         test_size_limit_option(db)
                         test_get_approximate_size(db)
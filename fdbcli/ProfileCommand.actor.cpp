@@ -22,6 +22,7 @@
 
 #include "fdbcli/fdbcli.actor.h"
 
+#include "fdbclient/ClientWorkerInterface.h"
 #include "fdbclient/GlobalConfig.actor.h"
 #include "fdbclient/FDBOptions.g.h"
 #include "fdbclient/IClientApi.h"
@@ -125,6 +126,65 @@ ACTOR Future<bool> profileCommandActor(Reference<ITransaction> tr, std::vector<S
 			        .removePrefix(LiteralStringRef("\xff\xff/worker_interfaces/"));
 			printf("%s\n", printable(ip_port).c_str());
 		}
+	} else if (tokencmp(tokens[1], "allocation")) {
+		if (tokens.size() < 4 ||
+		    !(tokencmp(tokens[2], "enable") || tokencmp(tokens[2], "disable") || tokencmp(tokens[2], "get"))) {
+			fprintf(stderr, "ERROR: Usage: profile allocation <enable|disable|get> <PROCESS...|all>\n");
+			return false;
+		}
+		state std::map<Key, std::pair<Value, ClientLeaderRegInterface>> address_interface;
+		wait(getWorkerInterfaces(tr, &address_interface));
+		state std::vector<Key> processes;
+		if (tokens.size() == 4 && tokencmp(tokens[3], "all")) {
+			for (const auto& it : address_interface) {
+				processes.push_back(it.first);
+			}
+		} else {
+			for (int t = 3; t < tokens.size(); t++) {
+				if (!address_interface.count(tokens[t])) {
+					fprintf(stderr, "ERROR: process `%s' not recognized.\n", printable(tokens[t]).c_str());
+					return false;
+				}
+				processes.push_back(tokens[t]);
+			}
+		}
+
+		state int i;
+		if (tokencmp(tokens[2], "get")) {
+			// Sampled call sites are read from each process through the special key space
+			for (i = 0; i < processes.size(); i++) {
+				state Key prefix =
+				    processes[i].withPrefix("\xff\xff/metrics/allocation_samples/"_sr).withSuffix("/"_sr);
+				state ThreadFuture<RangeResult> sitesFuture =
+				    tr->getRange(KeyRangeRef(prefix, strinc(prefix)), CLIENT_KNOBS->TOO_MANY);
+				RangeResult sites = wait(safeThreadFutureToFuture(sitesFuture));
+				printf("%s:\n", printable(processes[i]).c_str());
+				for (const auto& site : sites) {
+					printf("  %s\n", printable(site.value).c_str());
+				}
+			}
+		} else {
+			state std::vector<Future<ErrorOr<Void>>> replies;
+			for (const auto& process : processes) {
+				ProfilerRequest req(ProfilerRequest::Type::ALLOCATION,
+				                    tokencmp(tokens[2], "enable") ? ProfilerRequest::Action::ENABLE
+				                                                  : ProfilerRequest::Action::DISABLE,
+				                    0);
+				ClientWorkerInterface interf = BinaryReader::fromStringRef<ClientWorkerInterface>(
+				    address_interface[process].first, IncludeVersion());
+				replies.push_back(interf.profiler.tryGetReply(req));
+			}
+			wait(waitForAll(replies));
+			for (i = 0; i < replies.size(); i++) {
+				if (replies[i].get().isError()) {
+					fprintf(stderr,
+					        "ERROR: %s: %s\n",
+					        printable(processes[i]).c_str(),
+					        replies[i].get().getError().what());
+					result = false;
+				}
+			}
+		}
 	} else {
 		fprintf(stderr, "ERROR: Unknown type: %s\n", printable(tokens[1]).c_str());
 		result = false;
@@ -133,7 +193,7 @@ ACTOR Future<bool> profileCommandActor(Reference<ITransaction> tr, std::vector<S
 }
 
 CommandFactory profileFactory("profile",
-                              CommandHelp("profile <client|list> <action> <ARGS>",
+                              CommandHelp("profile <client|list|allocation> <action> <ARGS>",
                                           "namespace for all the profiling-related commands.",
                                           "Different types support different actions.  Run `profile` to get a list of "
                                           "types, and iteratively explore the help.\n"));
@@ -69,6 +69,8 @@ void ClientKnobs::initialize(Randomize randomize) {
 	init( BACKOFF_GROWTH_RATE,                     2.0 );
 	init( RESOURCE_CONSTRAINED_MAX_BACKOFF,       30.0 );
 	init( PROXY_COMMIT_OVERHEAD_BYTES,              23 ); //The size of serializing 7 tags (3 primary, 3 remote, 1 log router) + 2 for the tag length
+	init( COMMIT_COALESCING_MAX_TRANSACTIONS,      100 ); if( randomize && BUGGIFY ) COMMIT_COALESCING_MAX_TRANSACTIONS = 2;
+	init( COMMIT_COALESCING_MAX_BYTES,             1e6 ); if( randomize && BUGGIFY ) COMMIT_COALESCING_MAX_BYTES = 1000;
 	init( SHARD_STAT_SMOOTH_AMOUNT,                5.0 );
 	init( INIT_MID_SHARD_BYTES,               50000000 ); if( randomize && BUGGIFY ) INIT_MID_SHARD_BYTES = 40000; else if(randomize && BUGGIFY_WITH_PROB(0.75)) INIT_MID_SHARD_BYTES = 200000; // The same value as SERVER_KNOBS->MIN_SHARD_BYTES
 
@@ -90,6 +92,8 @@ void ClientKnobs::initialize(Randomize randomize) {
 
 	init( LOCATION_CACHE_EVICTION_SIZE,         600000 );
 	init( LOCATION_CACHE_EVICTION_SIZE_SIM,         10 ); if( randomize && BUGGIFY ) LOCATION_CACHE_EVICTION_SIZE_SIM = 3;
+	init( LOCATION_CACHE_PREFETCH_BATCH_SIZE,     1000 ); if( randomize && BUGGIFY ) LOCATION_CACHE_PREFETCH_BATCH_SIZE = 2;
+	init( LOCATION_INFO_PRUNE_SIZE,               1000 ); if( randomize && BUGGIFY ) LOCATION_INFO_PRUNE_SIZE = 1;
 	init( LOCATION_CACHE_ENDPOINT_FAILURE_GRACE_PERIOD,     60 );
 	init( LOCATION_CACHE_FAILED_ENDPOINT_RETRY_INTERVAL,    60 );
 	init( TENANT_CACHE_EVICTION_SIZE,           100000 );
@@ -109,6 +113,7 @@ void ClientKnobs::initialize(Randomize randomize) {
 	init( RANGESTREAM_BUFFERED_FRAGMENTS_LIMIT,     20 );
 	init( QUARANTINE_TSS_ON_MISMATCH,             true ); if( randomize && BUGGIFY ) QUARANTINE_TSS_ON_MISMATCH = false; // if true, a tss mismatch will put the offending tss in quarantine. If false, it will just be killed
 	init( CHANGE_FEED_EMPTY_BATCH_TIME,          0.005 );
+	init( RYW_UNMODIFIED_READ_FAST_PATH,          true ); if( randomize && BUGGIFY ) RYW_UNMODIFIED_READ_FAST_PATH = false;
 
 	//KeyRangeMap
 	init( KRM_GET_RANGE_LIMIT,                     1e5 ); if( randomize && BUGGIFY ) KRM_GET_RANGE_LIMIT = 10;
@@ -68,6 +68,8 @@ public:
 	double BACKOFF_GROWTH_RATE;
 	double RESOURCE_CONSTRAINED_MAX_BACKOFF;
 	int PROXY_COMMIT_OVERHEAD_BYTES;
+	int COMMIT_COALESCING_MAX_TRANSACTIONS; // Most commits sent to a commit proxy in one coalesced request
+	int COMMIT_COALESCING_MAX_BYTES; // Coalesced requests are sent once their commits are at least this large
 	double SHARD_STAT_SMOOTH_AMOUNT;
 	int INIT_MID_SHARD_BYTES;
 
@@ -90,6 +92,8 @@ public:
 	// When locationCache in DatabaseContext gets to be this size, items will be evicted
 	int LOCATION_CACHE_EVICTION_SIZE;
 	int LOCATION_CACHE_EVICTION_SIZE_SIM;
+	int LOCATION_CACHE_PREFETCH_BATCH_SIZE; // Shards requested at a time when prefetching locations for a key prefix
+	int LOCATION_INFO_PRUNE_SIZE; // Smallest number of shared LocationInfos kept before unused ones are pruned
 	double LOCATION_CACHE_ENDPOINT_FAILURE_GRACE_PERIOD;
 	double LOCATION_CACHE_FAILED_ENDPOINT_RETRY_INTERVAL;
 	int TENANT_CACHE_EVICTION_SIZE;
@@ -109,6 +113,7 @@ public:
 	int RANGESTREAM_BUFFERED_FRAGMENTS_LIMIT;
 	bool QUARANTINE_TSS_ON_MISMATCH;
 	double CHANGE_FEED_EMPTY_BATCH_TIME;
+	bool RYW_UNMODIFIED_READ_FAST_PATH; // RYW reads skip merging with the write map while the transaction has no writes
 
 	// KeyRangeMap
 	int KRM_GET_RANGE_LIMIT;
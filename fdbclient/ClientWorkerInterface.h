@@ -72,6 +72,7 @@ struct ProfilerRequest {
 		GPROF = 1,
 		FLOW = 2,
 		GPROF_HEAP = 3,
+		ALLOCATION = 4, // sampled FastAllocator and arena allocation call sites, traced when disabled
 	};
 
 	enum class Action : std::int8_t { DISABLE = 0, ENABLE = 1, RUN = 2 };
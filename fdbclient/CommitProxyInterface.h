@@ -59,6 +59,7 @@ struct CommitProxyInterface {
 	RequestStream<struct ProxySnapRequest> proxySnapReq;
 	RequestStream<struct ExclusionSafetyCheckRequest> exclusionSafetyCheckReq;
 	RequestStream<struct GetDDMetricsRequest> getDDMetrics;
+	PublicRequestStream<struct CommitTransactionBatchRequest> commitBatch;
 
 	UID id() const { return commit.getEndpoint().token; }
 	std::string toString() const { return id().shortString(); }
@@ -85,6 +86,8 @@ struct CommitProxyInterface {
 			exclusionSafetyCheckReq =
 			    RequestStream<struct ExclusionSafetyCheckRequest>(commit.getEndpoint().getAdjustedEndpoint(8));
 			getDDMetrics = RequestStream<struct GetDDMetricsRequest>(commit.getEndpoint().getAdjustedEndpoint(9));
+			commitBatch =
+			    PublicRequestStream<struct CommitTransactionBatchRequest>(commit.getEndpoint().getAdjustedEndpoint(10));
 		}
 	}
 
@@ -101,6 +104,7 @@ struct CommitProxyInterface {
 		streams.push_back(proxySnapReq.getReceiver());
 		streams.push_back(exclusionSafetyCheckReq.getReceiver());
 		streams.push_back(getDDMetrics.getReceiver());
+		streams.push_back(commitBatch.getReceiver(TaskPriority::ReadSocket));
 		FlowTransport::transport().addEndpoints(streams);
 	}
 };
@@ -182,6 +186,18 @@ struct CommitTransactionRequest : TimedRequest {
 	}
 };
 
+// Independent commits that a client coalesced into one message. The proxy commits each request exactly as if it had
+// been sent on its own, and each gets its own reply.
+struct CommitTransactionBatchRequest {
+	constexpr static FileIdentifier file_identifier = 2893471;
+	std::vector<CommitTransactionRequest> requests;
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, requests);
+	}
+};
+
 static inline int getBytes(CommitTransactionRequest const& r) {
 	// SOMEDAY: Optimize
 	// return r.arena.getSize(); // NOT correct because arena can be shared!
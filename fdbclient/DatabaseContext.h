@@ -27,6 +27,7 @@
 #include "flow/genericactors.actor.h"
 #include <vector>
 #include <unordered_map>
+#include <set>
 #pragma once
 
 #include "fdbclient/FDBTypes.h"
@@ -71,6 +72,22 @@ struct LocationInfo : MultiInterface<ReferencedInterface<StorageServerInterface>
 	Reference<Locations> locations() { return Reference<Locations>::addRef(this); }
 };
 
+// A location cache entry. Shards on the same team share one LocationInfo, so each cached shard also carries its own
+// id. Entries only compare equal when both are empty or are the same shard, which keeps the coalescing location cache
+// from merging adjacent shards of one team into a single range.
+struct CachedLocation {
+	Reference<LocationInfo> info;
+	uint64_t shard = 0;
+
+	CachedLocation() {}
+	CachedLocation(Reference<LocationInfo> info, uint64_t shard) : info(std::move(info)), shard(shard) {}
+
+	explicit operator bool() const { return info.isValid(); }
+	LocationInfo* operator->() const { return info.getPtr(); }
+	bool operator==(const CachedLocation& r) const { return info == r.info && shard == r.shard; }
+	bool operator!=(const CachedLocation& r) const { return !(*this == r); }
+};
+
 using CommitProxyInfo = ModelInterface<CommitProxyInterface>;
 using GrvProxyInfo = ModelInterface<GrvProxyInterface>;
 
@@ -273,6 +290,8 @@ public:
 	void invalidateCachedTenant(const TenantNameRef& tenant);
 	void invalidateCache(const KeyRef& tenantPrefix, const KeyRef& key, Reverse isBackward = Reverse::False);
 	void invalidateCache(const KeyRef& tenantPrefix, const KeyRangeRef& keys);
+	// Returns the LocationInfo shared by every cached shard on exactly these storage servers
+	Reference<LocationInfo> getLocationInfo(const std::vector<Reference<ReferencedInterface<StorageServerInterface>>>&);
 
 	// Records that `endpoint` is failed on a healthy server.
 	void setFailedEndpointOnHealthyServer(const Endpoint& endpoint);
@@ -432,6 +451,16 @@ public:
 	};
 	std::map<uint32_t, VersionBatcher> versionBatcher;
 
+	// Commits of transactions without read conflict ranges waiting to be sent to a commit proxy together. sentTo is
+	// set to the proxy once the batch holding req has been sent.
+	struct CoalescedCommit {
+		CommitTransactionRequest req;
+		Promise<CommitProxyInterface> sentTo;
+	};
+	double commitCoalescingDelay = 0;
+	PromiseStream<CoalescedCommit> commitCoalescer;
+	Future<Void> commitCoalescerActor;
+
 	AsyncTrigger connectionFileChangedTrigger;
 
 	// Disallow any reads at a read version lower than minAcceptableReadVersion.  This way the client does not have to
@@ -451,7 +480,14 @@ public:
 	// Cache of location information
 	int locationCacheSize;
 	int tenantCacheSize;
-	CoalescedKeyRangeMap<Reference<LocationInfo>> locationCache;
+	CoalescedKeyRangeMap<CachedLocation> locationCache;
+	uint64_t lastCachedShard = 0; // Id of the most recently cached shard
+	// Shards of the same team share one LocationInfo. Entries that only this map refers to are pruned once it has
+	// doubled in size since the last pruning.
+	std::map<std::vector<const ReferencedInterface<StorageServerInterface>*>, Reference<LocationInfo>> locationInfos;
+	size_t locationInfosPruneSize = 0;
+	std::vector<Future<Void>> locationCachePrefetchers;
+	std::set<Key> locationCachePrefetchedPrefixes;
 	std::unordered_map<Endpoint, EndpointFailureInfo> failedEndpointsOnHealthyServersInfo;
 	std::unordered_map<TenantName, TenantMapEntry> tenantCache;
 
@@ -525,15 +561,21 @@ public:
 	Counter transactionGrvFullBatches;
 	Counter transactionGrvTimedOutBatches;
 	Counter transactionsStaleVersionVectors;
+	Counter transactionReadVersionCacheHits;
+	Counter transactionReadVersionCacheMisses;
+	Counter transactionCommitsCoalesced;
+	Counter transactionCommitBatchesSent;
 
 	ContinuousSample<double> latencies, readLatencies, commitLatencies, GRVLatencies, mutationsPerCommit,
 	    bytesPerCommit, bgLatencies, bgGranulesPerRequest;
+	// How old the cached read versions handed to transactions with a maximum staleness were
+	ContinuousSample<double> readVersionStaleness;
 
 	int outstandingWatches;
 	int maxOutstandingWatches;
 
 	// Manage any shared state that may be used by MVC
-	DatabaseSharedState* sharedStatePtr;
+	DatabaseSharedState* sharedStatePtr = nullptr;
 	Future<DatabaseSharedState*> initSharedState();
 	void setSharedState(DatabaseSharedState* p);
 
@@ -2216,6 +2216,64 @@ ACTOR Future<Void> updateChangeFeed(Database cx, Key rangeID, ChangeFeedStatus s
 	}
 }
 
+ACTOR Future<Void> createSecondaryIndex(Database cx, Key name, SecondaryIndexDefinition definition) {
+	if (definition.recordPrefix.empty() || definition.indexPrefix.empty() ||
+	    definition.recordRange().intersects(definition.indexRange()) || definition.recordPrefix >= normalKeys.end ||
+	    definition.indexPrefix >= normalKeys.end || definition.valueElement < 0) {
+		throw client_invalid_operation();
+	}
+
+	state Transaction tr(cx);
+	loop {
+		try {
+			tr.setOption(FDBTransactionOptions::ACCESS_SYSTEM_KEYS);
+			Optional<Value> existing = wait(tr.get(name.withPrefix(secondaryIndexKeys.begin)));
+			if (existing.present()) {
+				SecondaryIndexDefinition existingDefinition = decodeSecondaryIndexDefinition(existing.get());
+				if (existingDefinition.recordPrefix != definition.recordPrefix ||
+				    existingDefinition.indexPrefix != definition.indexPrefix ||
+				    existingDefinition.valueElement != definition.valueElement) {
+					throw unsupported_operation();
+				}
+				return Void();
+			}
+
+			wait(updateChangeFeed(
+			    &tr, secondaryIndexFeedIdFor(name), ChangeFeedStatus::CHANGE_FEED_CREATE, definition.recordRange()));
+			tr.set(name.withPrefix(secondaryIndexKeys.begin), encodeSecondaryIndexDefinition(definition));
+			tr.set(secondaryIndexChangeKey, deterministicRandom()->randomUniqueID().toString());
+			wait(tr.commit());
+			return Void();
+		} catch (Error& e) {
+			wait(tr.onError(e));
+		}
+	}
+}
+
+ACTOR Future<Void> dropSecondaryIndex(Database cx, Key name) {
+	state Transaction tr(cx);
+	loop {
+		try {
+			tr.setOption(FDBTransactionOptions::ACCESS_SYSTEM_KEYS);
+			Optional<Value> existing = wait(tr.get(name.withPrefix(secondaryIndexKeys.begin)));
+			if (!existing.present()) {
+				return Void();
+			}
+
+			wait(updateChangeFeed(&tr, secondaryIndexFeedIdFor(name), ChangeFeedStatus::CHANGE_FEED_DESTROY));
+			tr.clear(decodeSecondaryIndexDefinition(existing.get()).indexRange());
+			tr.clear(name.withPrefix(secondaryIndexKeys.begin));
+			tr.clear(secondaryIndexProgressKeyFor(name));
+			tr.clear(prefixRange(secondaryIndexEntryPrefixFor(name)));
+			tr.set(secondaryIndexChangeKey, deterministicRandom()->randomUniqueID().toString());
+			wait(tr.commit());
+			return Void();
+		} catch (Error& e) {
+			wait(tr.onError(e));
+		}
+	}
+}
+
 ACTOR Future<Void> advanceVersion(Database cx, Version v) {
 	state Transaction tr(cx);
 	loop {
@@ -132,6 +132,13 @@ ACTOR Future<Void> updateChangeFeed(Reference<ReadYourWritesTransaction> tr,
                                     KeyRange range = KeyRange());
 ACTOR Future<Void> updateChangeFeed(Database cx, Key rangeID, ChangeFeedStatus status, KeyRange range = KeyRange());
 
+// Creates a secondary index that the cluster keeps up to date as the indexed records change. Index entries for the
+// records that already exist are written in the background. Creating an index that already exists with the same
+// definition does nothing.
+ACTOR Future<Void> createSecondaryIndex(Database cx, Key name, SecondaryIndexDefinition definition);
+// Drops a secondary index, clearing all of its entries
+ACTOR Future<Void> dropSecondaryIndex(Database cx, Key name);
+
 ACTOR Future<Void> advanceVersion(Database cx, Version v);
 
 ACTOR Future<int> setDDMode(Database cx, int mode);
@@ -1838,6 +1838,83 @@ void MultiVersionDatabase::LegacyVersionMonitor::close() {
 	}
 }
 
+// MultiThreadedDatabase
+MultiThreadedDatabase::MultiThreadedDatabase(std::vector<Reference<IDatabase>> dbs) : dbs(std::move(dbs)), next(0) {
+	ASSERT(!this->dbs.empty());
+}
+
+Reference<IDatabase> MultiThreadedDatabase::nextDatabase() {
+	return dbs[next.fetch_add(1, std::memory_order_relaxed) % dbs.size()];
+}
+
+Reference<ITenant> MultiThreadedDatabase::openTenant(TenantNameRef tenantName) {
+	std::vector<Reference<ITenant>> tenants;
+	for (auto& db : dbs) {
+		tenants.push_back(db->openTenant(tenantName));
+	}
+	return makeReference<MultiThreadedTenant>(std::move(tenants));
+}
+
+Reference<ITransaction> MultiThreadedDatabase::createTransaction() {
+	return nextDatabase()->createTransaction();
+}
+
+void MultiThreadedDatabase::setOption(FDBDatabaseOptions::Option option, Optional<StringRef> value) {
+	for (auto& db : dbs) {
+		db->setOption(option, value);
+	}
+}
+
+// Returns the busyness of the busiest of the threads, since that is the one that limits the database
+double MultiThreadedDatabase::getMainThreadBusyness() {
+	double busyness = 0;
+	for (auto& db : dbs) {
+		busyness = std::max(busyness, db->getMainThreadBusyness());
+	}
+	return busyness;
+}
+
+ThreadFuture<ProtocolVersion> MultiThreadedDatabase::getServerProtocol(Optional<ProtocolVersion> expectedVersion) {
+	return dbs[0]->getServerProtocol(expectedVersion);
+}
+
+ThreadFuture<int64_t> MultiThreadedDatabase::rebootWorker(const StringRef& address, bool check, int duration) {
+	return dbs[0]->rebootWorker(address, check, duration);
+}
+
+ThreadFuture<Void> MultiThreadedDatabase::forceRecoveryWithDataLoss(const StringRef& dcid) {
+	return dbs[0]->forceRecoveryWithDataLoss(dcid);
+}
+
+ThreadFuture<Void> MultiThreadedDatabase::createSnapshot(const StringRef& uid, const StringRef& snapshot_command) {
+	return dbs[0]->createSnapshot(uid, snapshot_command);
+}
+
+ThreadFuture<Key> MultiThreadedDatabase::purgeBlobGranules(const KeyRangeRef& keyRange,
+                                                           Version purgeVersion,
+                                                           bool force) {
+	return dbs[0]->purgeBlobGranules(keyRange, purgeVersion, force);
+}
+
+ThreadFuture<Void> MultiThreadedDatabase::waitPurgeGranulesComplete(const KeyRef& purgeKey) {
+	return dbs[0]->waitPurgeGranulesComplete(purgeKey);
+}
+
+ThreadFuture<DatabaseSharedState*> MultiThreadedDatabase::createSharedState() {
+	return dbs[0]->createSharedState();
+}
+
+void MultiThreadedDatabase::setSharedState(DatabaseSharedState* p) {
+	for (auto& db : dbs) {
+		db->setSharedState(p);
+	}
+}
+
+// MultiThreadedTenant
+Reference<ITransaction> MultiThreadedTenant::createTransaction() {
+	return tenants[next.fetch_add(1, std::memory_order_relaxed) % tenants.size()]->createTransaction();
+}
+
 // MultiVersionApi
 bool MultiVersionApi::apiVersionAtLeast(int minVersion) {
 	ASSERT_NE(MultiVersionApi::api->apiVersion, 0);
@@ -2143,6 +2220,13 @@ void MultiVersionApi::setNetworkOptionInternal(FDBNetworkOptions::Option option,
 		// multiple client threads are not supported on windows.
 		threadCount = extractIntOption(value, 1, 1);
 #endif
+	} else if (option == FDBNetworkOptions::CLIENT_THREADS_PER_DATABASE) {
+		MutexHolder holder(lock);
+		validateOption(value, true, false, false);
+		if (networkStartSetup) {
+			throw invalid_option();
+		}
+		threadsPerDatabase = extractIntOption(value, 1, 1024);
 	} else {
 		forwardOption = true;
 	}
@@ -2345,12 +2429,20 @@ Reference<IDatabase> MultiVersionApi::createDatabase(const char* clusterFilePath
 		ASSERT(!bypassMultiClientApi);
 
 		int threadIdx = nextThread;
-		nextThread = (nextThread + 1) % threadCount;
+		int dbThreadCount = std::min(threadsPerDatabase, threadCount);
+		nextThread = (nextThread + dbThreadCount) % threadCount;
 		lock.leave();
 
-		Reference<IDatabase> localDb = localClient->api->createDatabase(clusterFilePath);
-		return Reference<IDatabase>(
-		    new MultiVersionDatabase(this, threadIdx, clusterFile, Reference<IDatabase>(), localDb));
+		std::vector<Reference<IDatabase>> dbs;
+		for (int i = 0; i < dbThreadCount; ++i) {
+			Reference<IDatabase> localDb = localClient->api->createDatabase(clusterFilePath);
+			dbs.push_back(Reference<IDatabase>(new MultiVersionDatabase(
+			    this, (threadIdx + i) % threadCount, clusterFile, Reference<IDatabase>(), localDb)));
+		}
+		if (dbs.size() == 1) {
+			return dbs[0];
+		}
+		return makeReference<MultiThreadedDatabase>(std::move(dbs));
 	}
 
 	lock.leave();
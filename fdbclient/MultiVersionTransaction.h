@@ -832,6 +832,60 @@ public:
 	friend class MultiVersionTransaction;
 };
 
+// An implementation of IDatabase that spreads one logical database over several MultiVersionDatabases, each opened on
+// a different client thread. Transactions are created on the wrapped databases in turn, so a single heavily used
+// database can make use of more than one network thread. Each wrapped database keeps its own connections and location
+// cache, since they live in separate copies of the client library; the read version cache is already shared between
+// them through the cluster's DatabaseSharedState.
+class MultiThreadedDatabase final : public IDatabase, ThreadSafeReferenceCounted<MultiThreadedDatabase> {
+public:
+	explicit MultiThreadedDatabase(std::vector<Reference<IDatabase>> dbs);
+
+	Reference<ITenant> openTenant(TenantNameRef tenantName) override;
+	Reference<ITransaction> createTransaction() override;
+	void setOption(FDBDatabaseOptions::Option option, Optional<StringRef> value = Optional<StringRef>()) override;
+	double getMainThreadBusyness() override;
+
+	ThreadFuture<ProtocolVersion> getServerProtocol(
+	    Optional<ProtocolVersion> expectedVersion = Optional<ProtocolVersion>()) override;
+
+	void addref() override { ThreadSafeReferenceCounted<MultiThreadedDatabase>::addref(); }
+	void delref() override { ThreadSafeReferenceCounted<MultiThreadedDatabase>::delref(); }
+
+	ThreadFuture<int64_t> rebootWorker(const StringRef& address, bool check, int duration) override;
+	ThreadFuture<Void> forceRecoveryWithDataLoss(const StringRef& dcid) override;
+	ThreadFuture<Void> createSnapshot(const StringRef& uid, const StringRef& snapshot_command) override;
+
+	ThreadFuture<Key> purgeBlobGranules(const KeyRangeRef& keyRange, Version purgeVersion, bool force) override;
+	ThreadFuture<Void> waitPurgeGranulesComplete(const KeyRef& purgeKey) override;
+
+	ThreadFuture<DatabaseSharedState*> createSharedState() override;
+	void setSharedState(DatabaseSharedState* p) override;
+
+private:
+	// Returns the wrapped database that the next transaction or tenant should use
+	Reference<IDatabase> nextDatabase();
+
+	const std::vector<Reference<IDatabase>> dbs;
+	std::atomic<uint32_t> next;
+};
+
+// The ITenant counterpart of MultiThreadedDatabase, which creates transactions on tenants opened on each of the
+// wrapped databases in turn
+class MultiThreadedTenant final : public ITenant, ThreadSafeReferenceCounted<MultiThreadedTenant> {
+public:
+	explicit MultiThreadedTenant(std::vector<Reference<ITenant>> tenants) : tenants(std::move(tenants)), next(0) {}
+
+	Reference<ITransaction> createTransaction() override;
+
+	void addref() override { ThreadSafeReferenceCounted<MultiThreadedTenant>::addref(); }
+	void delref() override { ThreadSafeReferenceCounted<MultiThreadedTenant>::delref(); }
+
+private:
+	const std::vector<Reference<ITenant>> tenants;
+	std::atomic<uint32_t> next;
+};
+
 // An implementation of IClientApi that can choose between multiple different client implementations either provided
 // locally within the primary loaded fdb_c client or through any number of dynamically loaded clients.
 //
@@ -898,6 +952,8 @@ private:
 
 	int nextThread = 0;
 	int threadCount;
+	// The number of client threads that each database created by createDatabase is spread across
+	int threadsPerDatabase = 1;
 
 	Mutex lock;
 	std::vector<std::pair<FDBNetworkOptions::Option, Optional<Standalone<StringRef>>>> options;
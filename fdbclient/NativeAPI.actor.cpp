@@ -586,6 +586,7 @@ ACTOR Future<Void> databaseLogger(DatabaseContext* cx) {
 			cx->cc.logToTraceEvent(ev);
 
 			ev.detail("LocationCacheEntryCount", cx->locationCache.size());
+			ev.detail("LocationInfoCount", cx->locationInfos.size());
 			ev.detail("MeanLatency", cx->latencies.mean())
 			    .detail("MedianLatency", cx->latencies.median())
 			    .detail("Latency90", cx->latencies.percentile(0.90))
@@ -606,6 +607,9 @@ ACTOR Future<Void> databaseLogger(DatabaseContext* cx) {
 			    .detail("MeanBytesPerCommit", cx->bytesPerCommit.mean())
 			    .detail("MedianBytesPerCommit", cx->bytesPerCommit.median())
 			    .detail("MaxBytesPerCommit", cx->bytesPerCommit.max())
+			    .detail("MeanReadVersionStaleness", cx->readVersionStaleness.mean())
+			    .detail("MedianReadVersionStaleness", cx->readVersionStaleness.median())
+			    .detail("MaxReadVersionStaleness", cx->readVersionStaleness.max())
 			    .detail("NumLocalityCacheEntries", cx->locationCache.size());
 			if (cx->anyBlobGranuleRequests) {
 				ev.detail("MeanBGLatency", cx->bgLatencies.mean())
@@ -625,6 +629,7 @@ ACTOR Future<Void> databaseLogger(DatabaseContext* cx) {
 		cx->bytesPerCommit.clear();
 		cx->bgLatencies.clear();
 		cx->bgGranulesPerRequest.clear();
+		cx->readVersionStaleness.clear();
 
 		lastLogged = now();
 	}
@@ -916,7 +921,7 @@ void updateLocationCacheWithCaches(DatabaseContext* self,
 	auto ranges = self->locationCache.ranges();
 	for (auto iter = ranges.begin(); iter != ranges.end(); ++iter) {
 		if (iter->value() && iter->value()->hasCaches) {
-			auto& val = iter->value();
+			auto& val = iter->value().info;
 			std::vector<Reference<ReferencedInterface<StorageServerInterface>>> interfaces;
 			interfaces.reserve(val->size() - removed.size() + added.size());
 			for (int i = 0; i < val->size(); ++i) {
@@ -928,7 +933,7 @@ void updateLocationCacheWithCaches(DatabaseContext* self,
 			for (const auto& p : added) {
 				interfaces.push_back(makeReference<ReferencedInterface<StorageServerInterface>>(p.second));
 			}
-			iter->value() = makeReference<LocationInfo>(interfaces, true);
+			val = makeReference<LocationInfo>(interfaces, true);
 		}
 	}
 }
@@ -987,25 +992,26 @@ ACTOR Future<Void> updateCachedRanges(DatabaseContext* self, std::map<UID, Stora
 						for (auto iter = ranges.begin(); iter != ranges.end(); ++iter) {
 							containedRangesEnd = iter->range().end;
 							if (iter->value() && !iter->value()->hasCaches) {
-								iter->value() = addCaches(iter->value(), cacheInterfaces);
+								iter->value().info = addCaches(iter->value().info, cacheInterfaces);
 							}
 						}
 						auto iter = self->locationCache.rangeContaining(begin);
 						if (iter->value() && !iter->value()->hasCaches) {
+							CachedLocation cached(addCaches(iter->value().info, cacheInterfaces),
+							                      ++self->lastCachedShard);
 							if (end >= iter->range().end) {
 								Key endCopy = iter->range().end; // Copy because insertion invalidates iterator
-								self->locationCache.insert(KeyRangeRef{ begin, endCopy },
-								                           addCaches(iter->value(), cacheInterfaces));
+								self->locationCache.insert(KeyRangeRef{ begin, endCopy }, cached);
 							} else {
-								self->locationCache.insert(KeyRangeRef{ begin, end },
-								                           addCaches(iter->value(), cacheInterfaces));
+								self->locationCache.insert(KeyRangeRef{ begin, end }, cached);
 							}
 						}
 						iter = self->locationCache.rangeContainingKeyBefore(end);
 						if (iter->value() && !iter->value()->hasCaches) {
 							Key beginCopy = iter->range().begin; // Copy because insertion invalidates iterator
-							self->locationCache.insert(KeyRangeRef{ beginCopy, end },
-							                           addCaches(iter->value(), cacheInterfaces));
+							CachedLocation cached(addCaches(iter->value().info, cacheInterfaces),
+							                      ++self->lastCachedShard);
+							self->locationCache.insert(KeyRangeRef{ beginCopy, end }, cached);
 						}
 					}
 				}
@@ -1436,13 +1442,18 @@ DatabaseContext::DatabaseContext(Reference<AsyncVar<Reference<IClusterConnection
     transactionsProcessBehind("ProcessBehind", cc), transactionsThrottled("Throttled", cc),
     transactionsExpensiveClearCostEstCount("ExpensiveClearCostEstCount", cc),
     transactionGrvFullBatches("NumGrvFullBatches", cc), transactionGrvTimedOutBatches("NumGrvTimedOutBatches", cc),
-    transactionsStaleVersionVectors("NumStaleVersionVectors", cc), latencies(1000), readLatencies(1000),
-    commitLatencies(1000), GRVLatencies(1000), mutationsPerCommit(1000), bytesPerCommit(1000), bgLatencies(1000),
-    bgGranulesPerRequest(1000), outstandingWatches(0), sharedStatePtr(nullptr), lastGrvTime(0.0), cachedReadVersion(0),
-    lastRkBatchThrottleTime(0.0), lastRkDefaultThrottleTime(0.0), lastProxyRequestTime(0.0),
-    transactionTracingSample(false), taskID(taskID), clientInfo(clientInfo), clientInfoMonitor(clientInfoMonitor),
-    coordinator(coordinator), apiVersion(apiVersion), mvCacheInsertLocation(0), healthMetricsLastUpdated(0),
-    detailedHealthMetricsLastUpdated(0), smoothMidShardSize(CLIENT_KNOBS->SHARD_STAT_SMOOTH_AMOUNT),
+    transactionsStaleVersionVectors("NumStaleVersionVectors", cc),
+    transactionReadVersionCacheHits("ReadVersionCacheHits", cc),
+    transactionReadVersionCacheMisses("ReadVersionCacheMisses", cc),
+    transactionCommitsCoalesced("CommitsCoalesced", cc), transactionCommitBatchesSent("CommitBatchesSent", cc),
+    latencies(1000), readLatencies(1000), commitLatencies(1000), GRVLatencies(1000), mutationsPerCommit(1000),
+    bytesPerCommit(1000), bgLatencies(1000), bgGranulesPerRequest(1000), readVersionStaleness(1000),
+    outstandingWatches(0), sharedStatePtr(nullptr),
+    lastGrvTime(0.0), cachedReadVersion(0), lastRkBatchThrottleTime(0.0), lastRkDefaultThrottleTime(0.0),
+    lastProxyRequestTime(0.0), transactionTracingSample(false), taskID(taskID), clientInfo(clientInfo),
+    clientInfoMonitor(clientInfoMonitor), coordinator(coordinator), apiVersion(apiVersion), mvCacheInsertLocation(0),
+    healthMetricsLastUpdated(0), detailedHealthMetricsLastUpdated(0),
+    smoothMidShardSize(CLIENT_KNOBS->SHARD_STAT_SMOOTH_AMOUNT),
     specialKeySpace(std::make_unique<SpecialKeySpace>(specialKeys.begin, specialKeys.end, /* test */ false)),
     connectToDatabaseEventCacheHolder(format("ConnectToDatabase/%s", dbId.toString().c_str())) {
 	dbId = deterministicRandom()->randomUniqueID();
@@ -1617,6 +1628,12 @@ DatabaseContext::DatabaseContext(Reference<AsyncVar<Reference<IClusterConnection
 		    SpecialKeySpace::IMPLTYPE::READONLY,
 		    std::make_unique<HealthMetricsRangeImpl>(KeyRangeRef(LiteralStringRef("\xff\xff/metrics/health/"),
 		                                                         LiteralStringRef("\xff\xff/metrics/health0"))));
+		registerSpecialKeySpaceModule(
+		    SpecialKeySpace::MODULE::METRICS,
+		    SpecialKeySpace::IMPLTYPE::READONLY,
+		    std::make_unique<AllocationSamplesImpl>(
+		        KeyRangeRef(LiteralStringRef("\xff\xff/metrics/allocation_samples/"),
+		                    LiteralStringRef("\xff\xff/metrics/allocation_samples0"))));
 		registerSpecialKeySpaceModule(
 		    SpecialKeySpace::MODULE::WORKERINTERFACE,
 		    SpecialKeySpace::IMPLTYPE::READONLY,
@@ -1709,9 +1726,13 @@ DatabaseContext::DatabaseContext(const Error& err)
     transactionsProcessBehind("ProcessBehind", cc), transactionsThrottled("Throttled", cc),
     transactionsExpensiveClearCostEstCount("ExpensiveClearCostEstCount", cc),
     transactionGrvFullBatches("NumGrvFullBatches", cc), transactionGrvTimedOutBatches("NumGrvTimedOutBatches", cc),
-    transactionsStaleVersionVectors("NumStaleVersionVectors", cc), latencies(1000), readLatencies(1000),
-    commitLatencies(1000), GRVLatencies(1000), mutationsPerCommit(1000), bytesPerCommit(1000), bgLatencies(1000),
-    bgGranulesPerRequest(1000), transactionTracingSample(false),
+    transactionsStaleVersionVectors("NumStaleVersionVectors", cc),
+    transactionReadVersionCacheHits("ReadVersionCacheHits", cc),
+    transactionReadVersionCacheMisses("ReadVersionCacheMisses", cc),
+    transactionCommitsCoalesced("CommitsCoalesced", cc), transactionCommitBatchesSent("CommitBatchesSent", cc),
+    latencies(1000), readLatencies(1000), commitLatencies(1000), GRVLatencies(1000), mutationsPerCommit(1000),
+    bytesPerCommit(1000), bgLatencies(1000), bgGranulesPerRequest(1000), readVersionStaleness(1000),
+    transactionTracingSample(false),
     smoothMidShardSize(CLIENT_KNOBS->SHARD_STAT_SMOOTH_AMOUNT),
     connectToDatabaseEventCacheHolder(format("ConnectToDatabase/%s", dbId.toString().c_str())) {}
 
@@ -1746,13 +1767,16 @@ DatabaseContext::~DatabaseContext() {
 	if (grvUpdateHandler.isValid()) {
 		grvUpdateHandler.cancel();
 	}
+	for (auto& prefetcher : locationCachePrefetchers) {
+		prefetcher.cancel();
+	}
 	if (sharedStatePtr) {
 		sharedStatePtr->delRef(sharedStatePtr);
 	}
 	for (auto it = server_interf.begin(); it != server_interf.end(); it = server_interf.erase(it))
 		it->second->notifyContextDestroyed();
 	ASSERT_ABORT(server_interf.empty());
-	locationCache.insert(allKeys, Reference<LocationInfo>());
+	locationCache.insert(allKeys, CachedLocation());
 }
 
 Optional<KeyRangeLocationInfo> DatabaseContext::getCachedLocation(const Optional<TenantName>& tenantName,
@@ -1775,7 +1799,8 @@ Optional<KeyRangeLocationInfo> DatabaseContext::getCachedLocation(const Optional
 	auto range =
 	    isBackward ? locationCache.rangeContainingKeyBefore(resolvedKey) : locationCache.rangeContaining(resolvedKey);
 	if (range->value()) {
-		return KeyRangeLocationInfo(tenantEntry, toRelativeRange(range->range(), tenantEntry.prefix), range->value());
+		return KeyRangeLocationInfo(
+		    tenantEntry, toRelativeRange(range->range(), tenantEntry.prefix), range->value().info);
 	}
 
 	return Optional<KeyRangeLocationInfo>();
@@ -1812,7 +1837,8 @@ bool DatabaseContext::getCachedLocations(const Optional<TenantName>& tenantName,
 			result.clear();
 			return false;
 		}
-		result.emplace_back(tenantEntry, toRelativeRange(r->range() & resolvedRange, tenantEntry.prefix), r->value());
+		result.emplace_back(
+		    tenantEntry, toRelativeRange(r->range() & resolvedRange, tenantEntry.prefix), r->value().info);
 		if (result.size() == limit || begin == end) {
 			break;
 		}
@@ -1853,15 +1879,43 @@ Reference<LocationInfo> DatabaseContext::setCachedLocation(const Optional<Tenant
 	}
 
 	int maxEvictionAttempts = 100, attempts = 0;
-	auto loc = makeReference<LocationInfo>(serverRefs);
+	auto loc = getLocationInfo(serverRefs);
 	while (locationCache.size() > locationCacheSize && attempts < maxEvictionAttempts) {
 		TEST(true); // NativeAPI storage server locationCache entry evicted
 		attempts++;
 		auto r = locationCache.randomRange();
 		Key begin = r.begin(), end = r.end(); // insert invalidates r, so can't be passed a mere reference into it
-		locationCache.insert(KeyRangeRef(begin, end), Reference<LocationInfo>());
+		locationCache.insert(KeyRangeRef(begin, end), CachedLocation());
+	}
+	locationCache.insert(absoluteKeys, CachedLocation(loc, ++lastCachedShard));
+	return loc;
+}
+
+Reference<LocationInfo> DatabaseContext::getLocationInfo(
+    const std::vector<Reference<ReferencedInterface<StorageServerInterface>>>& serverRefs) {
+	std::vector<const ReferencedInterface<StorageServerInterface>*> team;
+	team.reserve(serverRefs.size());
+	for (const auto& ref : serverRefs) {
+		team.push_back(ref.getPtr());
+	}
+	std::sort(team.begin(), team.end());
+
+	auto& loc = locationInfos[team];
+	if (!loc) {
+		loc = makeReference<LocationInfo>(serverRefs);
+		if (locationInfos.size() >= locationInfosPruneSize) {
+			auto result = loc;
+			for (auto it = locationInfos.begin(); it != locationInfos.end();) {
+				if (it->second->isSoleOwner()) {
+					it = locationInfos.erase(it);
+				} else {
+					++it;
+				}
+			}
+			locationInfosPruneSize = std::max<size_t>(CLIENT_KNOBS->LOCATION_INFO_PRUNE_SIZE, 2 * locationInfos.size());
+			return result;
+		}
 	}
-	locationCache.insert(absoluteKeys, loc);
 	return loc;
 }
 
@@ -1877,9 +1931,9 @@ void DatabaseContext::invalidateCache(const KeyRef& tenantPrefix, const KeyRef&
 	}
 
 	if (isBackward) {
-		locationCache.rangeContainingKeyBefore(resolvedKey)->value() = Reference<LocationInfo>();
+		locationCache.rangeContainingKeyBefore(resolvedKey)->value() = CachedLocation();
 	} else {
-		locationCache.rangeContaining(resolvedKey)->value() = Reference<LocationInfo>();
+		locationCache.rangeContaining(resolvedKey)->value() = CachedLocation();
 	}
 }
 
@@ -1893,7 +1947,7 @@ void DatabaseContext::invalidateCache(const KeyRef& tenantPrefix, const KeyRange
 	auto rs = locationCache.intersectingRanges(resolvedKeys);
 	Key begin = rs.begin().begin(),
 	    end = rs.end().begin(); // insert invalidates rs, so can't be passed a mere reference into it
-	locationCache.insert(KeyRangeRef(begin, end), Reference<LocationInfo>());
+	locationCache.insert(KeyRangeRef(begin, end), CachedLocation());
 }
 
 void DatabaseContext::setFailedEndpointOnHealthyServer(const Endpoint& endpoint) {
@@ -1961,6 +2015,9 @@ uint64_t extractHexOption(StringRef value) {
 	return id;
 }
 
+ACTOR Future<Void> prefetchLocations(DatabaseContext* cx, KeyRange keys);
+ACTOR Future<Void> coalesceCommits(DatabaseContext* cx);
+
 void DatabaseContext::setOption(FDBDatabaseOptions::Option option, Optional<StringRef> value) {
 	int defaultFor = FDBDatabaseOptions::optionInfo.getMustExist(option).defaultFor;
 	if (defaultFor >= 0) {
@@ -1983,7 +2040,24 @@ void DatabaseContext::setOption(FDBDatabaseOptions::Option option, Optional<Stri
 			if (clientInfo->get().grvProxies.size())
 				grvProxies = makeReference<GrvProxyInfo>(clientInfo->get().grvProxies, BalanceOnRequests::True);
 			server_interf.clear();
-			locationCache.insert(allKeys, Reference<LocationInfo>());
+			locationInfos.clear();
+			locationCache.insert(allKeys, CachedLocation());
+			break;
+		case FDBDatabaseOptions::LOCATION_CACHE_PREFETCH_PREFIX: {
+			Key prefix = value.present() ? Key(value.get()) : Key();
+			// Setting the same prefix again, e.g. from several clients of one database, does not fetch it twice
+			if (!locationCachePrefetchedPrefixes.insert(prefix).second) {
+				break;
+			}
+			KeyRange keys = prefix.size() ? prefixRange(prefix) : normalKeys;
+			locationCachePrefetchers.push_back(prefetchLocations(this, keys));
+			break;
+		}
+		case FDBDatabaseOptions::COMMIT_COALESCING_DELAY:
+			commitCoalescingDelay = extractIntOption(value, 0, 1e6) / 1e6;
+			if (commitCoalescingDelay > 0 && !commitCoalescerActor.isValid()) {
+				commitCoalescerActor = coalesceCommits(this);
+			}
 			break;
 		case FDBDatabaseOptions::MAX_WATCHES:
 			maxOutstandingWatches = (int)extractIntOption(value, 0, CLIENT_KNOBS->ABSOLUTE_MAX_WATCHES);
@@ -1999,7 +2073,8 @@ void DatabaseContext::setOption(FDBDatabaseOptions::Option option, Optional<Stri
 			if (clientInfo->get().grvProxies.size())
 				grvProxies = makeReference<GrvProxyInfo>(clientInfo->get().grvProxies, BalanceOnRequests::True);
 			server_interf.clear();
-			locationCache.insert(allKeys, Reference<LocationInfo>());
+			locationInfos.clear();
+			locationCache.insert(allKeys, CachedLocation());
 			break;
 		case FDBDatabaseOptions::SNAPSHOT_RYW_ENABLE:
 			validateOptionValueNotPresent(value);
@@ -3000,6 +3075,46 @@ ACTOR Future<std::vector<KeyRangeLocationInfo>> getKeyRangeLocations_internal(
 	}
 }
 
+// Fills the location cache for keys with a few large requests, so that the first transactions a client runs on the
+// range do not each wait for a location lookup. Stops early once it has fetched as many shards as the cache can hold.
+// Like clientStatusUpdateActor, it takes a pointer rather than a Database and only holds a reference to cx while a
+// request is outstanding, so it does not keep cx alive; it is cancelled when cx is destroyed.
+ACTOR Future<Void> prefetchLocations(DatabaseContext* cx, KeyRange keys) {
+	state Transaction tr;
+	state Key begin = keys.begin;
+	state int shards = 0;
+	state double startTime = now();
+	while (begin < keys.end && shards < cx->locationCacheSize) {
+		wait(refreshTransaction(cx, &tr));
+		try {
+			std::vector<KeyRangeLocationInfo> locations =
+			    wait(getKeyRangeLocations_internal(tr.getDatabase(),
+			                                       Optional<TenantName>(),
+			                                       KeyRangeRef(begin, keys.end),
+			                                       CLIENT_KNOBS->LOCATION_CACHE_PREFETCH_BATCH_SIZE,
+			                                       Reverse::False,
+			                                       SpanID(),
+			                                       Optional<UID>(),
+			                                       UseProvisionalProxies::False,
+			                                       latestVersion));
+			shards += locations.size();
+			begin = locations.back().range.end;
+		} catch (Error& e) {
+			if (e.code() == error_code_actor_cancelled) {
+				throw;
+			}
+			// Prefetching is only an optimization; transactions will look up whatever is missing
+			TraceEvent(SevWarn, "LocationCachePrefetchFailed").error(e).detail("Range", keys);
+			return Void();
+		}
+	}
+	TraceEvent("LocationCachePrefetched")
+	    .detail("Range", keys)
+	    .detail("Shards", shards)
+	    .detail("Elapsed", now() - startTime);
+	return Void();
+}
+
 // Get the SS locations for each shard in the 'keys' key-range;
 // Returned vector size is the number of shards in the input keys key-range.
 // Returned vector element is <ShardRange, storage server location info> pairs, where
@@ -5426,6 +5541,143 @@ Future<RangeResult> Transaction::getRange(const KeySelector& begin,
 	return getRange(begin, end, GetRangeLimits(limit), snapshot, reverse);
 }
 
+// Reads the rows of keys that match filter one shard at a time. Each request continues after the last key the previous
+// storage server scanned, which is past the last row it returned when the rows in between did not match.
+ACTOR Future<RangeResult> getFilteredRange(Reference<TransactionState> trState,
+                                           Future<Version> fVersion,
+                                           KeyRange keys,
+                                           Standalone<RangeReadFilterRef> filter,
+                                           GetRangeLimits limits,
+                                           Promise<std::pair<Key, Key>> conflictRange) {
+	state RangeResult output;
+	state Span span("NAPI:getFilteredRange"_loc, trState->spanID);
+	state Key begin = keys.begin;
+
+	if (trState->tenant().present()) {
+		span.addTag("tenant"_sr, trState->tenant().get());
+	}
+
+	try {
+		state Version version = wait(fVersion);
+		loop {
+			if (begin >= keys.end) {
+				output.more = false;
+				break;
+			}
+
+			state std::vector<KeyRangeLocationInfo> locations =
+			    wait(getKeyRangeLocations(trState,
+			                              KeyRangeRef(begin, keys.end),
+			                              1,
+			                              Reverse::False,
+			                              &StorageServerInterface::getKeyValues,
+			                              UseTenant::True,
+			                              version));
+			ASSERT(locations.size());
+			try {
+				GetKeyValuesRequest req;
+				req.tenantInfo = trState->getTenantInfo();
+				req.version = version;
+				req.begin = firstGreaterOrEqual(locations[0].range.begin);
+				req.end = firstGreaterOrEqual(locations[0].range.end);
+				req.spanContext = span.context;
+				req.filter = filter;
+				req.arena.dependsOn(filter.arena());
+				req.arena.dependsOn(locations[0].range.arena());
+				trState->cx->getLatestCommitVersions(
+				    locations[0].locations, req.version, trState, req.ssLatestCommitVersions);
+				transformRangeLimits(limits, Reverse::False, req);
+				req.tags = trState->cx->sampleReadTags() ? trState->options.readTags : Optional<TagSet>();
+				req.debugID = trState->debugID;
+
+				++trState->cx->transactionPhysicalReads;
+				state GetKeyValuesReply rep;
+				try {
+					GetKeyValuesReply _rep =
+					    wait(loadBalance(trState->cx.getPtr(),
+					                     locations[0].locations,
+					                     &StorageServerInterface::getKeyValues,
+					                     req,
+					                     TaskPriority::DefaultPromiseEndpoint,
+					                     AtMostOnce::False,
+					                     trState->cx->enableLocalityLoadBalance ? &trState->cx->queueModel : nullptr));
+					rep = _rep;
+					++trState->cx->transactionPhysicalReadsCompleted;
+				} catch (Error&) {
+					++trState->cx->transactionPhysicalReadsCompleted;
+					throw;
+				}
+
+				output.arena().dependsOn(rep.arena);
+				output.append(output.arena(), rep.data.begin(), rep.data.size());
+				limits.decrement(rep.data);
+				if (rep.more) {
+					// A server that ignored the filter cannot say where its scan stopped
+					if (!rep.lastScannedKey.present()) {
+						TraceEvent(SevWarnAlways, "FilteredRangeReplyMissingLastScannedKey")
+						    .detail("Begin", locations[0].range.begin)
+						    .detail("End", locations[0].range.end)
+						    .detail("Cached", rep.cached);
+						throw unsupported_operation();
+					}
+					begin = keyAfter(rep.lastScannedKey.get());
+				} else {
+					begin = locations[0].range.end;
+				}
+
+				// Like getExactRange, return early once the byte limit has been satisfied by some rows
+				if (begin < keys.end && (limits.isReached() || (limits.hasSatisfiedMinRows() && output.size() > 0))) {
+					output.more = true;
+					output.readThrough = KeyRef(output.arena(), begin);
+					break;
+				}
+			} catch (Error& e) {
+				if (e.code() == error_code_wrong_shard_server || e.code() == error_code_all_alternatives_failed) {
+					trState->cx->invalidateCache(locations[0].tenantEntry.prefix, KeyRangeRef(begin, keys.end));
+					wait(delay(CLIENT_KNOBS->WRONG_SHARD_SERVER_DELAY, trState->taskID));
+				} else if (e.code() == error_code_unknown_tenant) {
+					ASSERT(trState->tenant().present());
+					trState->cx->invalidateCachedTenant(trState->tenant().get());
+					wait(delay(CLIENT_KNOBS->UNKNOWN_TENANT_RETRY_DELAY, trState->taskID));
+				} else {
+					throw;
+				}
+			}
+		}
+	} catch (Error& e) {
+		if (conflictRange.canBeSet()) {
+			conflictRange.send(std::make_pair(Key(), Key()));
+		}
+		throw;
+	}
+
+	if (conflictRange.canBeSet()) {
+		conflictRange.send(std::make_pair(keys.begin, output.more ? begin : keys.end));
+	}
+	return output;
+}
+
+Future<RangeResult> Transaction::getFilteredRange(const KeyRange& keys,
+                                                  Standalone<RangeReadFilterRef> const& filter,
+                                                  GetRangeLimits limits,
+                                                  Snapshot snapshot) {
+	++trState->cx->transactionLogicalReads;
+	++trState->cx->transactionGetRangeRequests;
+
+	if (limits.isReached() || keys.empty())
+		return RangeResult();
+
+	if (!limits.isValid())
+		return range_limits_invalid();
+
+	Promise<std::pair<Key, Key>> conflictRange;
+	if (!snapshot) {
+		extraConflictRanges.push_back(conflictRange.getFuture());
+	}
+
+	return ::getFilteredRange(trState, getReadVersion(), keys, filter, limits, conflictRange);
+}
+
 // A method for streaming data from the storage server that is more efficient than getRange when reading large amounts
 // of data
 Future<Void> Transaction::getRangeStream(const PromiseStream<RangeResult>& results,
@@ -5708,6 +5960,7 @@ void TransactionOptions::clear() {
 	expensiveClearCostEstimation = false;
 	useGrvCache = false;
 	skipGrvCache = false;
+	maxReadVersionStaleness = 0.0;
 	rawAccess = false;
 }
 
@@ -6024,6 +6277,74 @@ void applyTenantPrefix(CommitTransactionRequest& req, Key tenantPrefix) {
 	}
 }
 
+// Gathers the requests sent by commitCoalesced() for up to commitCoalescingDelay, and sends them to one commit proxy
+// in a single CommitTransactionBatchRequest
+ACTOR Future<Void> coalesceCommits(DatabaseContext* cx) {
+	state FutureStream<DatabaseContext::CoalescedCommit> commits = cx->commitCoalescer.getFuture();
+	state std::vector<DatabaseContext::CoalescedCommit> pending;
+	state int64_t pendingBytes;
+	state Future<Void> timeout;
+	state Reference<CommitProxyInfo> proxies;
+
+	loop {
+		DatabaseContext::CoalescedCommit first = waitNext(commits);
+		pending.push_back(first);
+		pendingBytes = getBytes(first.req);
+		timeout = delay(cx->commitCoalescingDelay);
+
+		while (pending.size() < CLIENT_KNOBS->COMMIT_COALESCING_MAX_TRANSACTIONS &&
+		       pendingBytes < CLIENT_KNOBS->COMMIT_COALESCING_MAX_BYTES) {
+			choose {
+				when(DatabaseContext::CoalescedCommit commit = waitNext(commits)) {
+					pending.push_back(commit);
+					pendingBytes += getBytes(commit.req);
+				}
+				when(wait(timeout)) { break; }
+			}
+		}
+
+		loop {
+			proxies = cx->getCommitProxies(UseProvisionalProxies::False);
+			if (proxies && proxies->size()) {
+				break;
+			}
+			wait(cx->onProxiesChanged());
+		}
+
+		// Commits whose transaction stopped waiting, e.g. because the proxies changed, must not be sent late
+		CommitTransactionBatchRequest batch;
+		for (auto& commit : pending) {
+			if (commit.sentTo.getFutureReferenceCount()) {
+				batch.requests.push_back(commit.req);
+			}
+		}
+		if (batch.requests.size()) {
+			CommitProxyInterface proxy = proxies->getInterface(proxies->getBest());
+			proxy.commitBatch.send(batch);
+			cx->transactionCommitsCoalesced += batch.requests.size();
+			++cx->transactionCommitBatchesSent;
+			for (auto& commit : pending) {
+				commit.sentTo.send(proxy);
+			}
+		}
+		pending.clear();
+	}
+}
+
+// Commits req through coalesceCommits(). The reply comes back through req.reply as for a commit sent on its own.
+ACTOR Future<CommitID> commitCoalesced(DatabaseContext* cx, CommitTransactionRequest req) {
+	state Future<CommitID> reply = brokenPromiseToMaybeDelivered(req.reply.getFuture());
+	state Promise<CommitProxyInterface> sentTo;
+	cx->commitCoalescer.send(DatabaseContext::CoalescedCommit{ req, sentTo });
+	CommitProxyInterface proxy = wait(sentTo.getFuture());
+	choose {
+		when(CommitID id = wait(reply)) { return id; }
+		when(wait(IFailureMonitor::failureMonitor().onDisconnectOrFailure(proxy.commitBatch.getEndpoint()))) {
+			throw request_maybe_delivered();
+		}
+	}
+}
+
 ACTOR static Future<Void> tryCommit(Reference<TransactionState> trState,
                                     CommitTransactionRequest req,
                                     Future<Version> readVersion) {
@@ -6081,6 +6402,9 @@ ACTOR static Future<Void> tryCommit(Reference<TransactionState> trState,
 				reply = proxies.size() ? throwErrorOr(brokenPromiseToMaybeDelivered(proxies[0].commit.tryGetReply(req)))
 				                       : Never();
 			}
+		} else if (trState->cx->commitCoalescingDelay > 0 && !trState->useProvisionalProxies &&
+		           req.transaction.read_conflict_ranges.empty()) {
+			reply = commitCoalesced(trState->cx.getPtr(), req);
 		} else {
 			reply = basicLoadBalance(trState->cx->getCommitProxies(trState->useProvisionalProxies),
 			                         &CommitProxyInterface::commit,
@@ -6546,6 +6870,15 @@ void Transaction::setOption(FDBTransactionOptions::Option option, Optional<Strin
 		validateOptionValueNotPresent(value);
 		trState->options.skipGrvCache = true;
 		break;
+
+	case FDBTransactionOptions::MAX_READ_VERSION_STALENESS: {
+		// A version older than the default MVCC window of 5 seconds could not be read at anyway
+		int64_t staleness = extractIntOption(value, 0, 5000);
+		if (trState->numErrors == 0) {
+			trState->options.maxReadVersionStaleness = staleness / 1000.0;
+		}
+		break;
+	}
 	case FDBTransactionOptions::READ_SYSTEM_KEYS:
 	case FDBTransactionOptions::ACCESS_SYSTEM_KEYS:
 	case FDBTransactionOptions::RAW_ACCESS:
@@ -6835,6 +7168,21 @@ bool rkThrottlingCooledDown(DatabaseContext* cx, TransactionPriority priority) {
 
 Future<Version> Transaction::getReadVersion(uint32_t flags) {
 	if (!readVersion.isValid()) {
+		if (trState->options.maxReadVersionStaleness > 0 && !CLIENT_KNOBS->FORCE_GRV_CACHE_OFF &&
+		    !trState->options.skipGrvCache &&
+		    rkThrottlingCooledDown(getDatabase().getPtr(), trState->options.priority)) {
+			// The cache is kept fresh by the replies of other transactions, so a miss falls through to a regular GRV
+			// request, whose reply refreshes it
+			Version rv = trState->cx->getCachedReadVersion();
+			double staleness = now() - trState->cx->getLastGrvTime();
+			if (rv != Version(0) && staleness <= trState->options.maxReadVersionStaleness) {
+				++trState->cx->transactionReadVersionCacheHits;
+				trState->cx->readVersionStaleness.addSample(staleness);
+				readVersion = rv;
+				return readVersion;
+			}
+			++trState->cx->transactionReadVersionCacheMisses;
+		}
 		if (!CLIENT_KNOBS->FORCE_GRV_CACHE_OFF && !trState->options.skipGrvCache &&
 		    (deterministicRandom()->random01() <= CLIENT_KNOBS->DEBUG_USE_GRV_CACHE_CHANCE ||
 		     trState->options.useGrvCache) &&
@@ -9389,4 +9737,48 @@ ACTOR Future<Void> waitPurgeGranulesCompleteActor(Reference<DatabaseContext> db,
 
 Future<Void> DatabaseContext::waitPurgeGranulesComplete(Key purgeKey) {
 	return waitPurgeGranulesCompleteActor(Reference<DatabaseContext>::addRef(this), purgeKey);
-}
\ No newline at end of file
+}
+
+// Adjacent shards on the same team share one LocationInfo, but must still be cached, returned and invalidated as
+// separate shards
+TEST_CASE("/fdbclient/NativeAPI/locationCache/adjacentShardsOnOneTeam") {
+	state Database cx(new DatabaseContext(operation_cancelled()));
+	cx->locationCacheSize = 100;
+	{
+		std::vector<StorageServerInterface> team(3);
+		for (auto& ssi : team) {
+			ssi.initEndpoints();
+		}
+		cx->setCachedLocation(Optional<TenantName>(), TenantMapEntry(), KeyRangeRef("a"_sr, "b"_sr), team);
+		cx->setCachedLocation(Optional<TenantName>(), TenantMapEntry(), KeyRangeRef("b"_sr, "c"_sr), team);
+		cx->setCachedLocation(Optional<TenantName>(), TenantMapEntry(), KeyRangeRef("c"_sr, "d"_sr), team);
+	}
+
+	// All three shards are cached, so this does not go to the proxies
+	std::vector<KeyRangeLocationInfo> locations = wait(getKeyRangeLocations(cx,
+	                                                                        Optional<TenantName>(),
+	                                                                        KeyRangeRef("a"_sr, "d"_sr),
+	                                                                        CLIENT_KNOBS->TOO_MANY,
+	                                                                        Reverse::False,
+	                                                                        &StorageServerInterface::getValue,
+	                                                                        SpanID(),
+	                                                                        Optional<UID>(),
+	                                                                        UseProvisionalProxies::False,
+	                                                                        latestVersion));
+	ASSERT(locations.size() == 3);
+	ASSERT(locations[0].range == KeyRangeRef("a"_sr, "b"_sr));
+	ASSERT(locations[1].range == KeyRangeRef("b"_sr, "c"_sr));
+	ASSERT(locations[2].range == KeyRangeRef("c"_sr, "d"_sr));
+	ASSERT(locations[0].locations == locations[1].locations && locations[1].locations == locations[2].locations);
+
+	// Invalidating one shard leaves its neighbours cached
+	cx->invalidateCache(KeyRef(), "b"_sr);
+	Optional<TenantName> noTenant;
+	ASSERT(!cx->getCachedLocations(noTenant, KeyRangeRef("a"_sr, "d"_sr), locations, 100, Reverse::False));
+	ASSERT(cx->getCachedLocations(noTenant, KeyRangeRef("a"_sr, "b"_sr), locations, 100, Reverse::False));
+	ASSERT(cx->getCachedLocations(noTenant, KeyRangeRef("c"_sr, "d"_sr), locations, 100, Reverse::False));
+	ASSERT(locations.size() == 1);
+	ASSERT(locations[0].range == KeyRangeRef("c"_sr, "d"_sr));
+
+	return Void();
+}
@@ -147,6 +147,7 @@ struct TransactionOptions {
 	uint32_t getReadVersionFlags;
 	uint32_t sizeLimit;
 	int maxTransactionLoggingFieldLength;
+	double maxReadVersionStaleness;
 	bool checkWritesEnabled : 1;
 	bool causalWriteRisky : 1;
 	bool commitOnFirstProxy : 1;
@@ -324,6 +325,14 @@ public:
 		                reverse);
 	}
 
+	// Returns the rows of keys that match filter, which the storage servers evaluate so that the rows that do not
+	// match are not sent. If the result has more set, the next read has to begin at its readThrough, which can be past
+	// the last row returned.
+	[[nodiscard]] Future<RangeResult> getFilteredRange(const KeyRange& keys,
+	                                                   Standalone<RangeReadFilterRef> const& filter,
+	                                                   GetRangeLimits limits,
+	                                                   Snapshot = Snapshot::False);
+
 	[[nodiscard]] Future<MappedRangeResult> getMappedRange(const KeySelector& begin,
 	                                                       const KeySelector& end,
 	                                                       const Key& mapper,
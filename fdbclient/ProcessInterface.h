@@ -27,10 +27,11 @@ struct ProcessInterface {
 	constexpr static FileIdentifier file_identifier = 985636;
 	RequestStream<struct GetProcessInterfaceRequest> getInterface;
 	RequestStream<struct ActorLineageRequest> actorLineage;
+	RequestStream<struct AllocationSamplesRequest> allocationSamples;
 
 	template <class Ar>
 	void serialize(Ar& ar) {
-		serializer(ar, actorLineage);
+		serializer(ar, actorLineage, allocationSamples);
 	}
 };
 
@@ -78,3 +79,39 @@ struct ActorLineageRequest {
 		serializer(ar, waitStateStart, waitStateEnd, timeStart, timeEnd, reply);
 	}
 };
+
+// A call site recorded by allocation sampling, which is enabled with a ProfilerRequest of type ALLOCATION
+struct AllocationSample {
+	constexpr static FileIdentifier file_identifier = 4431972;
+	std::string source;
+	int64_t exampleSize = 0;
+	int64_t samples = 0;
+	int64_t estimatedBytes = 0;
+	std::string backtrace;
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, source, exampleSize, samples, estimatedBytes, backtrace);
+	}
+};
+
+struct AllocationSamplesReply {
+	constexpr static FileIdentifier file_identifier = 9185340;
+	std::vector<AllocationSample> sites; // by estimated bytes, largest first
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, sites);
+	}
+};
+
+struct AllocationSamplesRequest {
+	constexpr static FileIdentifier file_identifier = 13427718;
+	int topN = 0;
+	ReplyPromise<AllocationSamplesReply> reply;
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, topN, reply);
+	}
+};
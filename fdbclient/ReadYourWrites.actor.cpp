@@ -378,6 +378,27 @@ public:
 			when(wait(ryw->resetPromise.getFuture())) { throw internal_error(); }
 		}
 	}
+	// Used while the transaction has no writes: reads only the snapshot cache, skipping the merge with the write map
+	// that RYWIterator does. Conflict ranges are computed against the write map as it was when the read started, as
+	// in readWithConflictRangeRYW(), so writes issued while the read is outstanding are handled the same way.
+	ACTOR template <class Req>
+	static Future<typename Req::Result> readWithConflictRangeUnmodified(ReadYourWritesTransaction* ryw,
+	                                                                    Req req,
+	                                                                    Snapshot snapshot) {
+		state SnapshotCache::iterator it(&ryw->cache, &ryw->writes);
+		state WriteMap::iterator writes(&ryw->writes);
+		choose {
+			when(typename Req::Result result = wait(read(ryw, req, &it))) {
+				if (!snapshot) {
+					// The write map was empty, so this is its only segment, and it is unmodified
+					writes.skip(allKeys.begin);
+					addConflictRange(ryw, req, writes, result);
+				}
+				return result;
+			}
+			when(wait(ryw->resetPromise.getFuture())) { throw internal_error(); }
+		}
+	}
 	template <class Req>
 	static inline Future<typename Req::Result> readWithConflictRange(ReadYourWritesTransaction* ryw,
 	                                                                 Req const& req,
@@ -386,6 +407,8 @@ public:
 			return readWithConflictRangeThrough(ryw, req, snapshot);
 		} else if (snapshot && ryw->options.snapshotRywEnabled <= 0) {
 			return readWithConflictRangeSnapshot(ryw, req);
+		} else if (ryw->writes.empty() && CLIENT_KNOBS->RYW_UNMODIFIED_READ_FAST_PATH) {
+			return readWithConflictRangeUnmodified(ryw, req, snapshot);
 		}
 		return readWithConflictRangeRYW(ryw, req, snapshot);
 	}
@@ -1223,6 +1246,76 @@ public:
 #pragma endregion
 #endif
 
+	// The storage servers can only filter rows that this transaction has not written, so where keys contain writes
+	// that the read must see, the rows are read with getRange() and filtered here instead.
+	ACTOR static Future<RangeResult> getFilteredRange(ReadYourWritesTransaction* ryw,
+	                                                  KeyRange keys,
+	                                                  Standalone<RangeReadFilterRef> filter,
+	                                                  GetRangeLimits limits,
+	                                                  Snapshot snapshot) {
+		if (ryw->options.readYourWritesDisabled) {
+			choose {
+				when(RangeResult result = wait(ryw->tr.getFilteredRange(keys, filter, limits, snapshot))) {
+					return result;
+				}
+				when(wait(ryw->resetPromise.getFuture())) { throw internal_error(); }
+			}
+		}
+
+		state bool readsWrites = false;
+		if (!snapshot || ryw->options.snapshotRywEnabled > 0) {
+			WriteMap::iterator it(&ryw->writes);
+			for (it.skip(keys.begin); it.beginKey() < keys.end && !readsWrites; ++it) {
+				readsWrites = !it.is_unmodified_range();
+			}
+		}
+
+		if (!readsWrites) {
+			choose {
+				when(RangeResult result = wait(ryw->tr.getFilteredRange(keys, filter, limits, Snapshot::True))) {
+					if (!snapshot) {
+						KeyRangeRef readRange(KeyRef(ryw->arena, keys.begin),
+						                      KeyRef(ryw->arena, result.more ? result.readThrough.get() : keys.end));
+						WriteMap::iterator it(&ryw->writes);
+						it.skip(readRange.begin);
+						updateConflictMap(ryw, readRange, it);
+					}
+					return result;
+				}
+				when(wait(ryw->resetPromise.getFuture())) { throw internal_error(); }
+			}
+		}
+
+		state RangeResult output;
+		state Key begin = keys.begin;
+		loop {
+			RangeResult rows = wait(ryw->getRange(KeyRangeRef(begin, keys.end),
+			                                      GetRangeLimits(GetRangeLimits::ROW_LIMIT_UNLIMITED,
+			                                                     CLIENT_KNOBS->REPLY_BYTE_LIMIT),
+			                                      snapshot));
+			output.arena().dependsOn(rows.arena());
+			for (const KeyValueRef& kv : rows) {
+				begin = keyAfter(kv.key);
+				if (filter.matches(kv.key, kv.value)) {
+					output.push_back(output.arena(), kv);
+					limits.decrement(kv);
+					if (limits.isReached()) {
+						break;
+					}
+				}
+			}
+			if (begin >= keys.end || (!limits.isReached() && (!rows.more || rows.empty()))) {
+				output.more = false;
+				return output;
+			}
+			if (limits.isReached() || (limits.hasSatisfiedMinRows() && output.size() > 0)) {
+				output.more = true;
+				output.readThrough = KeyRef(output.arena(), begin);
+				return output;
+			}
+		}
+	}
+
 	static void triggerWatches(ReadYourWritesTransaction* ryw,
 	                           KeyRangeRef range,
 	                           Optional<ValueRef> val,
@@ -1261,6 +1354,10 @@ public:
 	                           KeyRef key,
 	                           Optional<ValueRef> val,
 	                           bool valueKnown = true) {
+		// Blind writes are the common case, so don't build the range if there is nothing to trigger
+		if (ryw->watchMap.empty()) {
+			return;
+		}
 		triggerWatches(ryw, singleKeyRange(key), val, valueKnown);
 	}
 
@@ -1730,6 +1827,42 @@ Future<MappedRangeResult> ReadYourWritesTransaction::getMappedRange(KeySelector
 	return result;
 }
 
+Future<RangeResult> ReadYourWritesTransaction::getFilteredRange(const KeyRange& keys,
+                                                                Standalone<RangeReadFilterRef> const& filter,
+                                                                GetRangeLimits limits,
+                                                                Snapshot snapshot) {
+	if (specialKeys.intersects(keys)) {
+		TEST(true); // Special key space get range (getFilteredRange)
+		return client_invalid_operation(); // Not support special keys.
+	}
+
+	if (checkUsedDuringCommit()) {
+		return used_during_commit();
+	}
+
+	if (resetPromise.isSet())
+		return resetPromise.getFuture().getError();
+
+	if (keys.end > getMaxReadKey())
+		return key_outside_legal_range();
+
+	if (limits.isReached()) {
+		TEST(true); // RYW range read limit 0 (getFilteredRange)
+		return RangeResult();
+	}
+
+	if (!limits.isValid())
+		return range_limits_invalid();
+
+	if (keys.empty())
+		return RangeResult();
+
+	Future<RangeResult> result = RYWImpl::getFilteredRange(this, keys, filter, limits, snapshot);
+
+	reading.add(success(result));
+	return result;
+}
+
 Future<Standalone<VectorRef<const char*>>> ReadYourWritesTransaction::getAddressesForKey(const Key& key) {
 	if (checkUsedDuringCommit()) {
 		return used_during_commit();
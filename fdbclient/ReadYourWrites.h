@@ -114,6 +114,11 @@ public:
 	                                         GetRangeLimits limits,
 	                                         Snapshot = Snapshot::False,
 	                                         Reverse = Reverse::False) override;
+	// Reads the rows of keys that match filter, filtering on the storage servers where the transaction has no writes
+	Future<RangeResult> getFilteredRange(const KeyRange& keys,
+	                                     Standalone<RangeReadFilterRef> const& filter,
+	                                     GetRangeLimits limits,
+	                                     Snapshot = Snapshot::False);
 
 	[[nodiscard]] Future<Standalone<VectorRef<const char*>>> getAddressesForKey(const Key& key) override;
 	Future<Standalone<VectorRef<KeyRef>>> getRangeSplitPoints(const KeyRange& range, int64_t chunkSize) override;
@@ -33,6 +33,7 @@
 #include <boost/algorithm/string.hpp>
 #include "fdbrpc/IAsyncFile.h"
 #include "flow/Hostname.h"
+#include "flow/IThreadPool.h"
 #include "flow/UnitTest.h"
 #include "fdbclient/rapidxml/rapidxml.hpp"
 #include "fdbclient/FDBAWSCredentialsProvider.h"
@@ -1423,32 +1424,43 @@ ACTOR Future<Void> writeEntireFileFromBuffer_impl(Reference<S3BlobStoreEndpoint>
 	return Void();
 }
 
+// Returns the base64 MD5 sum of content, computed on a compute thread when there are any. The shared_ptr keeps content
+// alive for the compute thread even if the caller is cancelled first.
+static Future<std::string> computeContentMD5(std::shared_ptr<const std::string> content,
+                                             Reference<IThreadPool> pool = getComputeThreadPool()) {
+	return runOnComputeThread<std::string>(
+	    [content]() {
+		    MD5_CTX sum;
+		    ::MD5_Init(&sum);
+		    ::MD5_Update(&sum, content->data(), content->size());
+		    std::string sumBytes;
+		    sumBytes.resize(16);
+		    ::MD5_Final((unsigned char*)sumBytes.data(), &sum);
+		    std::string contentMD5 = base64::encoder::from_string(sumBytes);
+		    contentMD5.resize(contentMD5.size() - 1);
+		    return contentMD5;
+	    },
+	    pool);
+}
+
 ACTOR Future<Void> writeEntireFile_impl(Reference<S3BlobStoreEndpoint> bstore,
                                         std::string bucket,
                                         std::string object,
                                         std::string content) {
 	state UnsentPacketQueue packets;
+	state int contentLen = content.size();
 	PacketWriter pw(packets.getWriteBuffer(content.size()), nullptr, Unversioned());
 	pw.serializeBytes(content);
 	if (content.size() > bstore->knobs.multipart_max_part_size)
 		throw file_too_large();
 
 	// Yield because we may have just had to copy several MB's into packet buffer chain and next we have to calculate an
-	// MD5 sum of it.
-	// TODO:  If this actor is used to send large files then combine the summing and packetization into a loop with a
-	// yield() every 20k or so.
+	// MD5 sum of it, which happens off the network thread when there are compute threads.
 	wait(yield());
 
-	MD5_CTX sum;
-	::MD5_Init(&sum);
-	::MD5_Update(&sum, content.data(), content.size());
-	std::string sumBytes;
-	sumBytes.resize(16);
-	::MD5_Final((unsigned char*)sumBytes.data(), &sum);
-	std::string contentMD5 = base64::encoder::from_string(sumBytes);
-	contentMD5.resize(contentMD5.size() - 1);
+	std::string contentMD5 = wait(computeContentMD5(std::make_shared<const std::string>(std::move(content))));
 
-	wait(writeEntireFileFromBuffer_impl(bstore, bucket, object, &packets, content.size(), contentMD5));
+	wait(writeEntireFileFromBuffer_impl(bstore, bucket, object, &packets, contentLen, contentMD5));
 	return Void();
 }
 
@@ -1670,4 +1682,25 @@ TEST_CASE("/backup/s3/v4headers") {
 	}
 
 	return Void();
-}
\ No newline at end of file
+}
+
+TEST_CASE("/backup/s3/contentMD5") {
+	noUnseed = true;
+
+	state std::shared_ptr<const std::string> content =
+	    std::make_shared<const std::string>("The quick brown fox jumps over the lazy dog");
+
+	// Inline unless COMPUTE_THREADS is set
+	std::string md5 = wait(computeContentMD5(content));
+	ASSERT(md5 == "nhB9nTcrtoJr2B01QqQZ1g==");
+
+	state Reference<IThreadPool> pool = createGenericThreadPool();
+	pool->addThread(new ComputeThreadReceiver(), "fdb-compute-test");
+	std::string pooled = wait(computeContentMD5(content, pool));
+	ASSERT(pooled == "nhB9nTcrtoJr2B01QqQZ1g==");
+	std::string empty = wait(computeContentMD5(std::make_shared<const std::string>(), pool));
+	ASSERT(empty == "1B2M2Y8AsgTpgAmY7PhCfg==");
+	wait(pool->stop());
+
+	return Void();
+}
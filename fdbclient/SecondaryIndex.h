@@ -0,0 +1,80 @@
+/*
+ * SecondaryIndex.h
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FDBCLIENT_SECONDARYINDEX_H
+#define FDBCLIENT_SECONDARYINDEX_H
+#pragma once
+
+#include "fdbclient/FDBTypes.h"
+#include "fdbclient/Tuple.h"
+#include "flow/flat_buffers.h"
+
+// A secondary index that is maintained by the cluster rather than by the clients writing the records. Every key in
+// [recordPrefix, strinc(recordPrefix)) is a record whose value is a packed tuple. For each record the index holds the
+// key indexPrefix + pack((value[valueElement],)) + (recordKey - recordPrefix) with an empty value. When the record keys
+// are tuples too, index entries are tuples that a mapped range read can join back to their records.
+//
+// Index entries are written asynchronously from a change feed on the record range, so they trail the records by
+// however far the index writer is behind.
+struct SecondaryIndexDefinition {
+	constexpr static FileIdentifier file_identifier = 1502913;
+
+	Key recordPrefix;
+	Key indexPrefix;
+	int valueElement = 0;
+
+	SecondaryIndexDefinition() {}
+	SecondaryIndexDefinition(KeyRef recordPrefix, KeyRef indexPrefix, int valueElement)
+	  : recordPrefix(recordPrefix), indexPrefix(indexPrefix), valueElement(valueElement) {}
+
+	bool operator==(SecondaryIndexDefinition const& r) const {
+		return recordPrefix == r.recordPrefix && indexPrefix == r.indexPrefix && valueElement == r.valueElement;
+	}
+	bool operator!=(SecondaryIndexDefinition const& r) const { return !(*this == r); }
+
+	KeyRange recordRange() const { return prefixRange(recordPrefix); }
+	KeyRange indexRange() const { return prefixRange(indexPrefix); }
+
+	// Returns the key of the index entry for a record, or an empty Optional if the record has no such entry because
+	// its value is not a tuple with at least valueElement + 1 elements
+	Optional<Key> indexEntryFor(KeyRef recordKey, ValueRef recordValue) const {
+		ASSERT(recordKey.startsWith(recordPrefix));
+		Tuple value;
+		try {
+			value = Tuple::unpack(recordValue);
+		} catch (Error& e) {
+			return Optional<Key>();
+		}
+		if (valueElement < 0 || valueElement >= value.size()) {
+			return Optional<Key>();
+		}
+		return value.subTuple(valueElement, valueElement + 1)
+		    .pack()
+		    .withPrefix(indexPrefix)
+		    .withSuffix(recordKey.removePrefix(recordPrefix));
+	}
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, recordPrefix, indexPrefix, valueElement);
+	}
+};
+
+#endif
@@ -275,6 +275,8 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( DD_TEAM_ZERO_SERVER_LEFT_LOG_DELAY,                    120 ); if( randomize && BUGGIFY ) DD_TEAM_ZERO_SERVER_LEFT_LOG_DELAY = 5;
 	init( DD_STORAGE_WIGGLE_PAUSE_THRESHOLD,                      10 ); if( randomize && BUGGIFY ) DD_STORAGE_WIGGLE_PAUSE_THRESHOLD = 1000;
 	init( DD_STORAGE_WIGGLE_STUCK_THRESHOLD,                      20 );
+	init( SECONDARY_INDEX_BATCH_SIZE,                           1000 ); if( randomize && BUGGIFY ) SECONDARY_INDEX_BATCH_SIZE = 5;
+	init( SECONDARY_INDEX_RETRY_DELAY,                           1.0 );
 
 	// TeamRemover
 	init( TR_FLAG_DISABLE_MACHINE_TEAM_REMOVER,                false ); if( randomize && BUGGIFY ) TR_FLAG_DISABLE_MACHINE_TEAM_REMOVER = deterministicRandom()->random01() < 0.1 ? true : false; // false by default. disable the consistency check when it's true
@@ -446,6 +448,8 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( ENFORCED_MIN_RECOVERY_DURATION,                       0.085 ); if( shortRecoveryDuration ) ENFORCED_MIN_RECOVERY_DURATION = 0.01;
 	init( REQUIRED_MIN_RECOVERY_DURATION,                       0.080 ); if( shortRecoveryDuration ) REQUIRED_MIN_RECOVERY_DURATION = 0.01;
 	init( ALWAYS_CAUSAL_READ_RISKY,                             false );
+	init( GRV_LEASE_DURATION,                                     0.0 ); if( randomize && BUGGIFY ) GRV_LEASE_DURATION = 0.05 + deterministicRandom()->random01() * 0.45; // 0 disables epoch leases
+	init( GRV_LEASE_CLOCK_DRIFT,                                 0.01 );
 	init( MAX_COMMIT_UPDATES,                                    2000 ); if( randomize && BUGGIFY ) MAX_COMMIT_UPDATES = 1;
 	init( MAX_PROXY_COMPUTE,                                      2.0 );
 	init( MAX_COMPUTE_PER_OPERATION,                              0.1 );
@@ -663,6 +667,8 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( FUTURE_VERSION_DELAY,                                  1.0 );
 	init( STORAGE_LIMIT_BYTES,                                500000 );
 	init( BUGGIFY_LIMIT_BYTES,                                  1000 );
+	init( RANGE_READ_FILTER_BATCH_ROWS,                         1000 ); if( randomize && BUGGIFY ) RANGE_READ_FILTER_BATCH_ROWS = 1;
+	init( RANGE_READ_FILTER_SCAN_BYTES,                      5000000 ); if( randomize && BUGGIFY ) RANGE_READ_FILTER_SCAN_BYTES = 1000;
 	init( FETCH_USING_STREAMING,                                true ); if( randomize && BUGGIFY ) FETCH_USING_STREAMING = false; //Determines if fetch keys uses streaming reads
 	init( FETCH_BLOCK_BYTES,                                     2e6 );
 	init( FETCH_KEYS_PARALLELISM_BYTES,                          4e6 ); if( randomize && BUGGIFY ) FETCH_KEYS_PARALLELISM_BYTES = 3e6;
@@ -841,6 +847,10 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( REDWOOD_HISTOGRAM_INTERVAL,                           30.0 );
 	init( REDWOOD_EVICT_UPDATED_PAGES,                          true ); if( randomize && BUGGIFY ) { REDWOOD_EVICT_UPDATED_PAGES = false; }
 	init( REDWOOD_DECODECACHE_REUSE_MIN_HEIGHT,                    2 ); if( randomize && BUGGIFY ) { REDWOOD_DECODECACHE_REUSE_MIN_HEIGHT = deterministicRandom()->randomInt(1, 7); }
+	init( REDWOOD_BULK_BUILD_BATCH_BYTES,               16 * 1024 * 1024 ); if( randomize && BUGGIFY ) { REDWOOD_BULK_BUILD_BATCH_BYTES = deterministicRandom()->randomInt(1, 100000); }
+	init( REDWOOD_POINT_READ_FILTER_BYTES,                         0 ); if( randomize && BUGGIFY ) { REDWOOD_POINT_READ_FILTER_BYTES = deterministicRandom()->randomInt(0, 10000000); }
+	init( REDWOOD_POINT_READ_FILTER_BITS_PER_KEY,                 10 ); if( randomize && BUGGIFY ) { REDWOOD_POINT_READ_FILTER_BITS_PER_KEY = deterministicRandom()->randomInt(1, 20); }
+	init( REDWOOD_READAHEAD_MAX_LEAVES,                           32 ); if( randomize && BUGGIFY ) { REDWOOD_READAHEAD_MAX_LEAVES = deterministicRandom()->randomInt(0, 64); }
 
 	// Server request latency measurement
 	init( LATENCY_SAMPLE_SIZE,                                100000 );
@@ -221,6 +221,8 @@ public:
 	int DD_TEAM_ZERO_SERVER_LEFT_LOG_DELAY;
 	int DD_STORAGE_WIGGLE_PAUSE_THRESHOLD; // How many unhealthy relocations are ongoing will pause storage wiggle
 	int DD_STORAGE_WIGGLE_STUCK_THRESHOLD; // How many times bestTeamStuck accumulate will pause storage wiggle
+	int SECONDARY_INDEX_BATCH_SIZE; // Records the data distributor's secondary index writer updates per transaction
+	double SECONDARY_INDEX_RETRY_DELAY; // Delay before a secondary index writer restarts after an error
 
 	// TeamRemover to remove redundant teams
 	bool TR_FLAG_DISABLE_MACHINE_TEAM_REMOVER; // disable the machineTeamRemover actor
@@ -370,6 +372,8 @@ public:
 	double ENFORCED_MIN_RECOVERY_DURATION;
 	double REQUIRED_MIN_RECOVERY_DURATION;
 	bool ALWAYS_CAUSAL_READ_RISKY;
+	double GRV_LEASE_DURATION; // How long a TLog promises not to be locked after confirming the epoch to a GRV proxy
+	double GRV_LEASE_CLOCK_DRIFT; // The largest relative difference in clock rates between processes
 	int MAX_COMMIT_UPDATES;
 	double MAX_PROXY_COMPUTE;
 	double MAX_COMPUTE_PER_OPERATION;
@@ -612,6 +616,8 @@ public:
 	double FUTURE_VERSION_DELAY;
 	int STORAGE_LIMIT_BYTES;
 	int BUGGIFY_LIMIT_BYTES;
+	int RANGE_READ_FILTER_BATCH_ROWS; // Rows a filtered range read reads at a time before filtering them
+	int RANGE_READ_FILTER_SCAN_BYTES; // Bytes a filtered range read may read before replying with what matched
 	bool FETCH_USING_STREAMING;
 	int FETCH_BLOCK_BYTES;
 	int FETCH_KEYS_PARALLELISM_BYTES;
@@ -808,6 +814,11 @@ public:
 	double REDWOOD_HISTOGRAM_INTERVAL;
 	bool REDWOOD_EVICT_UPDATED_PAGES; // Whether to prioritize eviction of updated pages from cache.
 	int REDWOOD_DECODECACHE_REUSE_MIN_HEIGHT; // Minimum height for which to keep and reuse page decode caches
+	int64_t REDWOOD_BULK_BUILD_BATCH_BYTES; // Bytes of records to accumulate per tree level before writing them to
+	                                        // pages during a bulk build
+	int64_t REDWOOD_POINT_READ_FILTER_BYTES; // Memory budget for leaf key filters used by point reads, 0 disables them
+	int REDWOOD_POINT_READ_FILTER_BITS_PER_KEY; // Bloom filter bits per key in leaf key filters
+	int REDWOOD_READAHEAD_MAX_LEAVES; // Max leaves range reads will load ahead of the scan, 0 for sibling prefetch only
 
 	// Server request latency measurement
 	int LATENCY_SAMPLE_SIZE;
@@ -2295,6 +2295,60 @@ Future<RangeResult> ActorLineageImpl::getRange(ReadYourWritesTransaction* ryw,
 	return actorLineageGetRangeActor(ryw, getKeyRange().begin, kr);
 }
 
+AllocationSamplesImpl::AllocationSamplesImpl(KeyRangeRef kr) : SpecialKeyRangeReadImpl(kr) {}
+
+ACTOR static Future<RangeResult> allocationSamplesGetRangeActor(ReadYourWritesTransaction* ryw,
+                                                                KeyRef prefix,
+                                                                KeyRangeRef kr) {
+	// The process is named by the first component of the begin key, and the range may not extend past its keys
+	StringRef hostString = kr.begin.removePrefix(prefix).eat("/");
+	state Key hostPrefix = hostString.withPrefix(prefix).withSuffix("/"_sr);
+	if (hostString.empty() || kr.end > strinc(hostPrefix)) {
+		ryw->setSpecialKeySpaceErrorMsg("the range must be within the keys of a single host");
+		throw special_keys_api_failure();
+	}
+	state NetworkAddress host;
+	try {
+		host = NetworkAddress::parse(hostString.toString());
+	} catch (Error& e) {
+		ryw->setSpecialKeySpaceErrorMsg("failed to parse host");
+		throw special_keys_api_failure();
+	}
+
+	state ProcessInterface process;
+	process.getInterface = RequestStream<GetProcessInterfaceRequest>(Endpoint::wellKnown({ host }, WLTOKEN_PROCESS));
+	ProcessInterface p = wait(retryBrokenPromise(process.getInterface, GetProcessInterfaceRequest{}));
+	process = p;
+
+	AllocationSamplesRequest req;
+	req.topN = FLOW_KNOBS->ALLOCATION_SAMPLES_LOGGED;
+	AllocationSamplesReply reply = wait(process.allocationSamples.getReply(req));
+
+	RangeResult result;
+	for (int i = 0; i < reply.sites.size(); i++) {
+		Key key = hostPrefix.withSuffix(format("%06d", i));
+		if (!kr.contains(key)) {
+			continue;
+		}
+		json_spirit::mObject site;
+		site["source"] = reply.sites[i].source;
+		site["example_size"] = reply.sites[i].exampleSize;
+		site["samples"] = reply.sites[i].samples;
+		site["estimated_bytes"] = reply.sites[i].estimatedBytes;
+		site["backtrace"] = reply.sites[i].backtrace;
+		std::string siteString =
+		    json_spirit::write_string(json_spirit::mValue(site), json_spirit::Output_options::raw_utf8);
+		result.push_back_deep(result.arena(), KeyValueRef(key, siteString));
+	}
+	return result;
+}
+
+Future<RangeResult> AllocationSamplesImpl::getRange(ReadYourWritesTransaction* ryw,
+                                                    KeyRangeRef kr,
+                                                    GetRangeLimits limitsHint) const {
+	return allocationSamplesGetRangeActor(ryw, getKeyRange().begin, kr);
+}
+
 namespace {
 std::string_view to_string_view(StringRef sr) {
 	return std::string_view(reinterpret_cast<const char*>(sr.begin()), sr.size());
@@ -504,6 +504,16 @@ public:
 	                             GetRangeLimits limitsHint) const override;
 };
 
+// Reads the call sites recorded by allocation sampling in one process, as
+// \xff\xff/metrics/allocation_samples/<ip:port>/<rank> := json
+class AllocationSamplesImpl : public SpecialKeyRangeReadImpl {
+public:
+	explicit AllocationSamplesImpl(KeyRangeRef kr);
+	Future<RangeResult> getRange(ReadYourWritesTransaction* ryw,
+	                             KeyRangeRef kr,
+	                             GetRangeLimits limitsHint) const override;
+};
+
 class ActorProfilerConf : public SpecialKeyRangeRWImpl {
 	bool didWrite = false;
 	std::map<std::string, std::string> config;
@@ -21,6 +21,7 @@
 // TODO this should really be renamed "TSSComparison.cpp"
 #include "fdbclient/StorageServerInterface.h"
 #include "fdbclient/BlobWorkerInterface.h"
+#include "fdbclient/Tuple.h"
 #include "flow/crc32c.h" // for crc32c_append, to checksum values in tss trace events
 
 // Includes template specializations for all tss operations on storage server types.
@@ -454,8 +455,98 @@ void TSSMetrics::recordLatency(const OverlappingChangeFeedsRequest& req, double
 template <>
 void TSSMetrics::recordLatency(const BlobGranuleFileRequest& req, double ssLatency, double tssLatency) {}
 
+bool RangeReadFilterRef::matches(KeyRef key, ValueRef value) const {
+	if (!keyPrefixes.empty() &&
+	    std::none_of(keyPrefixes.begin(), keyPrefixes.end(), [key](KeyRef prefix) { return key.startsWith(prefix); })) {
+		return false;
+	}
+	if (!value.startsWith(valuePrefix)) {
+		return false;
+	}
+	if (tupleElement < 0) {
+		return true;
+	}
+
+	Tuple tuple;
+	try {
+		tuple = Tuple::unpack(value);
+	} catch (Error& e) {
+		return false;
+	}
+	if (size_t(tupleElement) >= tuple.size()) {
+		return false;
+	}
+	int c = tuple.subTuple(tupleElement, tupleElement + 1).pack().compare(tupleOperand);
+	switch (comparison) {
+	case EQUAL:
+		return c == 0;
+	case NOT_EQUAL:
+		return c != 0;
+	case LESS:
+		return c < 0;
+	case LESS_OR_EQUAL:
+		return c <= 0;
+	case GREATER:
+		return c > 0;
+	case GREATER_OR_EQUAL:
+		return c >= 0;
+	default:
+		return false;
+	}
+}
+
 // -------------------
 
+TEST_CASE("/StorageServerInterface/RangeReadFilter") {
+	Arena arena;
+	Value small = Tuple().append(5).append("x"_sr).pack();
+	Value large = Tuple().append(300).append("y"_sr).pack();
+
+	RangeReadFilterRef filter;
+	ASSERT(filter.matches("a"_sr, small));
+	ASSERT(filter.matches("a"_sr, "not a tuple"_sr));
+
+	filter.keyPrefixes.push_back(arena, "ab"_sr);
+	filter.keyPrefixes.push_back(arena, "c"_sr);
+	ASSERT(filter.matches("abc"_sr, small));
+	ASSERT(filter.matches("c"_sr, small));
+	ASSERT(!filter.matches("a"_sr, small));
+	ASSERT(!filter.matches("b"_sr, small));
+
+	filter = RangeReadFilterRef();
+	filter.valuePrefix = "not"_sr;
+	ASSERT(filter.matches("a"_sr, "not a tuple"_sr));
+	ASSERT(!filter.matches("a"_sr, small));
+
+	// Integers of different lengths still compare by value
+	filter = RangeReadFilterRef();
+	filter.tupleElement = 0;
+	filter.tupleOperand = Tuple().append(100).pack();
+	filter.comparison = RangeReadFilterRef::LESS;
+	ASSERT(filter.matches("a"_sr, small));
+	ASSERT(!filter.matches("a"_sr, large));
+	ASSERT(!filter.matches("a"_sr, "not a tuple"_sr));
+	filter.comparison = RangeReadFilterRef::GREATER_OR_EQUAL;
+	ASSERT(!filter.matches("a"_sr, small));
+	ASSERT(filter.matches("a"_sr, large));
+
+	filter.tupleElement = 1;
+	filter.tupleOperand = Tuple().append("y"_sr).pack();
+	filter.comparison = RangeReadFilterRef::EQUAL;
+	ASSERT(!filter.matches("a"_sr, small));
+	ASSERT(filter.matches("a"_sr, large));
+	filter.comparison = RangeReadFilterRef::NOT_EQUAL;
+	ASSERT(filter.matches("a"_sr, small));
+	ASSERT(!filter.matches("a"_sr, large));
+
+	filter.tupleElement = 2;
+	ASSERT(!filter.matches("a"_sr, small));
+
+	RangeReadFilterRef copy(arena, filter);
+	ASSERT(copy.tupleElement == 2 && copy.tupleOperand == filter.tupleOperand);
+	return Void();
+}
+
 TEST_CASE("/StorageServerInterface/TSSCompare/TestComparison") {
 	printf("testing tss comparisons\n");
 
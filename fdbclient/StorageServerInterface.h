@@ -342,6 +342,39 @@ struct WatchValueRequest {
 	}
 };
 
+// A predicate that the storage server evaluates on every row of a range read, so that rows the client has no use for
+// are skipped before they are sent. A row matches when all of the conditions that are set hold.
+struct RangeReadFilterRef {
+	constexpr static FileIdentifier file_identifier = 3926731;
+
+	enum Comparison : uint8_t { EQUAL = 0, NOT_EQUAL, LESS, LESS_OR_EQUAL, GREATER, GREATER_OR_EQUAL };
+
+	// If not empty, the key has to start with one of these prefixes
+	VectorRef<KeyRef> keyPrefixes;
+	// The value has to start with this prefix
+	ValueRef valuePrefix;
+	// If tupleElement is not negative, the value has to be a tuple with more than tupleElement elements, and that
+	// element has to compare to the only element of the packed tuple tupleOperand as comparison says. Elements are
+	// compared by their packed representation, which orders them as the tuple layer does.
+	int tupleElement = -1;
+	uint8_t comparison = EQUAL;
+	ValueRef tupleOperand;
+
+	RangeReadFilterRef() {}
+	RangeReadFilterRef(Arena& a, const RangeReadFilterRef& copyFrom)
+	  : keyPrefixes(a, copyFrom.keyPrefixes), valuePrefix(a, copyFrom.valuePrefix),
+	    tupleElement(copyFrom.tupleElement), comparison(copyFrom.comparison), tupleOperand(a, copyFrom.tupleOperand) {}
+
+	bool matches(KeyRef key, ValueRef value) const;
+
+	size_t expectedSize() const { return keyPrefixes.expectedSize() + valuePrefix.size() + tupleOperand.size(); }
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, keyPrefixes, valuePrefix, tupleElement, comparison, tupleOperand);
+	}
+};
+
 struct GetKeyValuesReply : public LoadBalancedReply {
 	constexpr static FileIdentifier file_identifier = 1783066;
 	Arena arena;
@@ -349,12 +382,25 @@ struct GetKeyValuesReply : public LoadBalancedReply {
 	Version version; // useful when latestVersion was requested
 	bool more;
 	bool cached = false;
+	// Only used when the request has a filter. filteredBytes counts the rows that were read but did not match, and
+	// when more is set, the scan has to continue after lastScannedKey, which may be past the last row in data.
+	int64_t filteredBytes = 0;
+	Optional<KeyRef> lastScannedKey;
 
 	GetKeyValuesReply() : version(invalidVersion), more(false), cached(false) {}
 
 	template <class Ar>
 	void serialize(Ar& ar) {
-		serializer(ar, LoadBalancedReply::penalty, LoadBalancedReply::error, data, version, more, cached, arena);
+		serializer(ar,
+		           LoadBalancedReply::penalty,
+		           LoadBalancedReply::error,
+		           data,
+		           version,
+		           more,
+		           cached,
+		           arena,
+		           filteredBytes,
+		           lastScannedKey);
 	}
 };
 
@@ -376,6 +422,7 @@ struct GetKeyValuesRequest : TimedRequest {
 	VersionVector ssLatestCommitVersions; // includes the latest commit versions, as known
 	                                      // to this client, of all storage replicas that
 	                                      // serve the given key
+	Optional<RangeReadFilterRef> filter; // if present, only the rows that match it are returned
 
 	GetKeyValuesRequest() : isFetchKeys(false) {}
 
@@ -394,7 +441,8 @@ struct GetKeyValuesRequest : TimedRequest {
 		           spanContext,
 		           tenantInfo,
 		           arena,
-		           ssLatestCommitVersions);
+		           ssLatestCommitVersions,
+		           filter);
 	}
 };
 
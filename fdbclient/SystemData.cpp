@@ -1395,6 +1395,35 @@ const KeyRef tenantMapPrivatePrefix = "\xff\xff/tenantMap/"_sr;
 const KeyRef tenantLastIdKey = "\xff/tenantLastId/"_sr;
 const KeyRef tenantDataPrefixKey = "\xff/tenantDataPrefix"_sr;
 
+const KeyRangeRef secondaryIndexKeys("\xff\x02/secondaryIndex/def/"_sr, "\xff\x02/secondaryIndex/def0"_sr);
+const KeyRangeRef secondaryIndexProgressKeys("\xff\x02/secondaryIndex/progress/"_sr,
+                                             "\xff\x02/secondaryIndex/progress0"_sr);
+const KeyRangeRef secondaryIndexEntryKeys("\xff\x02/secondaryIndex/entry/"_sr, "\xff\x02/secondaryIndex/entry0"_sr);
+const KeyRef secondaryIndexChangeKey = "\xff\x02/secondaryIndexChange"_sr;
+
+Value encodeSecondaryIndexDefinition(SecondaryIndexDefinition const& definition) {
+	return ObjectWriter::toValue(definition, IncludeVersion());
+}
+
+SecondaryIndexDefinition decodeSecondaryIndexDefinition(ValueRef const& value) {
+	SecondaryIndexDefinition definition;
+	ObjectReader reader(value.begin(), IncludeVersion());
+	reader.deserialize(definition);
+	return definition;
+}
+
+Key secondaryIndexProgressKeyFor(KeyRef name) {
+	return name.withPrefix(secondaryIndexProgressKeys.begin);
+}
+
+Key secondaryIndexEntryPrefixFor(KeyRef name) {
+	return Tuple().append(name).pack().withPrefix(secondaryIndexEntryKeys.begin);
+}
+
+Key secondaryIndexFeedIdFor(KeyRef name) {
+	return name.withPrefix("secondaryIndex/"_sr);
+}
+
 // for tests
 void testSSISerdes(StorageServerInterface const& ssi) {
 	printf("ssi=\nid=%s\nlocality=%s\nisTss=%s\ntssId=%s\nacceptingRequests=%s\naddress=%s\ngetValue=%s\n\n\n",
@@ -28,6 +28,7 @@
 #include "fdbclient/BlobWorkerInterface.h" // TODO move the functions that depend on this out of here and into BlobWorkerInterface.h to remove this depdendency
 #include "fdbclient/StorageServerInterface.h"
 #include "Tenant.h"
+#include "fdbclient/SecondaryIndex.h"
 
 // Don't warn on constants being defined in this file.
 #pragma clang diagnostic push
@@ -624,6 +625,25 @@ extern const KeyRef tenantDataPrefixKey;
 Value encodeTenantEntry(TenantMapEntry const& tenantEntry);
 TenantMapEntry decodeTenantEntry(ValueRef const& value);
 
+// Secondary indexes maintained by the cluster
+//	"\xff\x02/secondaryIndex/def/[[name]]" := "[[SecondaryIndexDefinition]]"
+//	"\xff\x02/secondaryIndex/progress/[[name]]" := "[[Version]]"
+//		The index writer has applied every record mutation before this version to the index.
+//	"\xff\x02/secondaryIndex/entry/[[pack((name,))]][[recordKey]]" := "[[indexEntryKey]]"
+//		The index entry the index writer last wrote for a record, so that it can be cleared when the record changes.
+//	"\xff\x02/secondaryIndexChange" is changed whenever an index is created or dropped.
+extern const KeyRangeRef secondaryIndexKeys;
+extern const KeyRangeRef secondaryIndexProgressKeys;
+extern const KeyRangeRef secondaryIndexEntryKeys;
+extern const KeyRef secondaryIndexChangeKey;
+
+Value encodeSecondaryIndexDefinition(SecondaryIndexDefinition const& definition);
+SecondaryIndexDefinition decodeSecondaryIndexDefinition(ValueRef const& value);
+Key secondaryIndexProgressKeyFor(KeyRef name);
+Key secondaryIndexEntryPrefixFor(KeyRef name);
+// The ID of the change feed on an index's record range
+Key secondaryIndexFeedIdFor(KeyRef name);
+
 #pragma clang diagnostic pop
 
 #endif
@@ -74,4 +74,37 @@ TEST_CASE("performance/map/StringRef/VersionedMap") {
 	return Void();
 }
 
+TEST_CASE("/fdbclient/VersionedMap/overwrite") {
+	VersionedMap<int, int> vm;
+	std::map<int, int> expected[3];
+
+	for (Version v = 1; v <= 2; ++v) {
+		vm.createNewVersion(v);
+		for (int i = 0; i < 1000; ++i) {
+			int k = deterministicRandom()->randomInt(0, 200);
+			int value = deterministicRandom()->randomInt(0, 1000000);
+			vm.insert(k, value);
+			expected[v][k] = value;
+		}
+		if (v == 1) {
+			expected[2] = expected[1];
+		}
+	}
+
+	for (Version v = 1; v <= 2; ++v) {
+		auto view = vm.at(v);
+		view.validate();
+		auto e = expected[v].begin();
+		for (auto i = view.begin(); i != view.end(); ++i, ++e) {
+			ASSERT(e != expected[v].end());
+			ASSERT(i.key() == e->first);
+			ASSERT(*i == e->second);
+			ASSERT(i.insertVersion() <= v);
+		}
+		ASSERT(e == expected[v].end());
+	}
+
+	return Void();
+}
+
 void forceLinkVersionedMapTests() {}
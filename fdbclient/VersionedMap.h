@@ -293,6 +293,26 @@ void insert(Reference<PTree<T>>& p, Version at, const T& x) {
 	}
 }
 
+// Modifies p to point to a PTree in which the item equivalent to x (which must be present) is replaced by x. The new
+// node takes over the priority and children of the old one, so unlike remove() followed by insert() no rotations are
+// needed and only the nodes on the path to the item are updated.
+template <class T>
+void replace(Reference<PTree<T>>& p, Version at, const T& x) {
+	if (!p)
+		ASSERT(false); // attempt to replace item not present in PTree
+	if (x < p->data) {
+		Reference<PTree<T>> child = p->child(0, at);
+		replace(child, at, x);
+		p = update(p, 0, child, at);
+	} else if (p->data < x) {
+		Reference<PTree<T>> child = p->child(1, at);
+		replace(child, at, x);
+		p = update(p, 1, child, at);
+	} else {
+		p = makeReference<PTree<T>>(p->priority, x, p->left(at), p->right(at), at);
+	}
+}
+
 template <class T>
 Reference<PTree<T>> firstNode(const Reference<PTree<T>>& p, Version at) {
 	if (!p)
@@ -731,12 +751,14 @@ public:
 	// insert() and erase() invalidate atLatest() and all iterators into it
 	void insert(const K& k, const T& t) { insert(k, t, latestVersion); }
 	void insert(const K& k, const T& t, Version insertAt) {
+		// Overwriting an existing key swaps in a single replacement node rather than removing and reinserting it,
+		// which would rotate the old node down to a leaf and the new one back up, copying nodes at each step.
 		if (PTreeImpl::contains(roots.back().second, latestVersion, k))
-			PTreeImpl::remove(roots.back().second,
-			                  latestVersion,
-			                  k); // FIXME: Make PTreeImpl::insert do this automatically  (see also WriteMap.h FIXME)
-		PTreeImpl::insert(
-		    roots.back().second, latestVersion, MapPair<K, std::pair<T, Version>>(k, std::make_pair(t, insertAt)));
+			PTreeImpl::replace(
+			    roots.back().second, latestVersion, MapPair<K, std::pair<T, Version>>(k, std::make_pair(t, insertAt)));
+		else
+			PTreeImpl::insert(
+			    roots.back().second, latestVersion, MapPair<K, std::pair<T, Version>>(k, std::make_pair(t, insertAt)));
 	}
 	void erase(const K& begin, const K& end) { PTreeImpl::remove(roots.back().second, latestVersion, begin, end); }
 	void erase(const K& key) { // key must be present
@@ -255,6 +255,49 @@ Future<Void> AsyncFileCached::flush() {
 
 	std::vector<Future<Void>> unflushed;
 
+	// Issue runs of adjacent idle dirty pages as single large writes. Any page written this way is left in flushable
+	// with a writeThrough in progress, so the loop below just waits for it like any other in-flight page flush.
+	if (FLOW_KNOBS->FLOW_CACHEDFILE_MAX_COALESCED_WRITE_BYTES >= 2 * pageCache->pageSize && flushable.size() > 1) {
+		std::vector<AFCPage*> candidates;
+		for (auto p : flushable) {
+			if (p->dirty && p->valid && p->notReading.isReady() && p->notFlushing.isReady()) {
+				candidates.push_back(p);
+			}
+		}
+		std::sort(candidates.begin(), candidates.end(), [](AFCPage const* a, AFCPage const* b) {
+			return a->pageOffset < b->pageOffset;
+		});
+
+		int maxRunPages = FLOW_KNOBS->FLOW_CACHEDFILE_MAX_COALESCED_WRITE_BYTES / pageCache->pageSize;
+		int begin = 0;
+		while (begin < candidates.size()) {
+			int end = begin + 1;
+			while (end < candidates.size() && end - begin < maxRunPages &&
+			       candidates[end]->pageOffset == candidates[end - 1]->pageOffset + pageCache->pageSize) {
+				++end;
+			}
+
+			if (end - begin > 1) {
+				std::vector<AFCPage*> run(candidates.begin() + begin, candidates.begin() + end);
+				// The pages are marked clean and busy before the write starts, since it can complete and call
+				// try_evict() immediately. The placeholder keeps them unevictable until notFlushing is assigned.
+				Promise<Void> starting;
+				for (auto p : run) {
+					++p->writeThroughCount;
+					p->notFlushing = starting.getFuture();
+					p->clearDirty();
+				}
+				Promise<Void> writing;
+				Future<Void> f = AFCPage::writeThroughCoalesced(this, run, writing);
+				for (auto p : run) {
+					p->notFlushing = f;
+				}
+				unflushed.push_back(writing.getFuture());
+			}
+			begin = end;
+		}
+	}
+
 	int debug_count = flushable.size();
 	for (int i = 0; i < flushable.size();) {
 		auto p = flushable[i];
@@ -565,6 +565,69 @@ struct AFCPage : public EvictablePage, public FastAllocated<AFCPage> {
 		return Void();
 	}
 
+	// Writes a run of pages with contiguous offsets to the underlying file as a single write. The caller must have
+	// already marked each page as flushing (see AsyncFileCached::flush()), and every page must be valid, clean and
+	// idle when this is called.
+	ACTOR static Future<Void> writeThroughCoalesced(AsyncFileCached* owner,
+	                                                std::vector<AFCPage*> pages,
+	                                                Promise<Void> writing) {
+		state int pageSize = owner->pageCache->pageSize;
+		state int size = pageSize * pages.size();
+		state uint8_t* buffer = nullptr;
+
+		try {
+			// Wait for rate control if it is set
+			if (owner->getRateControl()) {
+				int allowance = pages.size();
+				// If I/O size is defined, wait for the calculated I/O quota
+				if (FLOW_KNOBS->FLOW_CACHEDFILE_WRITE_IO_SIZE > 0) {
+					allowance = (size + FLOW_KNOBS->FLOW_CACHEDFILE_WRITE_IO_SIZE - 1) /
+					            FLOW_KNOBS->FLOW_CACHEDFILE_WRITE_IO_SIZE; // round up
+					ASSERT(allowance > 0);
+				}
+				wait(owner->getRateControl()->getAllowance(allowance));
+			}
+
+			// Pages can be written to while the flush is in progress, so take a snapshot of their contents now
+			buffer = static_cast<uint8_t*>(allocateFast4kAligned(size));
+			for (int i = 0; i < pages.size(); ++i) {
+				AFCPage* p = pages[i];
+				ASSERT(p->pageOffset == pages[0]->pageOffset + int64_t(i) * pageSize);
+				memcpy(buffer + i * pageSize, p->data, pageSize);
+				if (p->pageOffset + pageSize > owner->length) {
+					ASSERT(p->pageOffset < owner->length);
+					memset(buffer + i * pageSize + owner->length - p->pageOffset,
+					       0,
+					       pageSize - (owner->length - p->pageOffset));
+				}
+			}
+
+			wait(owner->uncached->write(buffer, size, pages[0]->pageOffset));
+		} catch (Error& e) {
+			if (buffer != nullptr) {
+				freeFast4kAligned(size, buffer);
+			}
+			for (auto p : pages) {
+				--p->writeThroughCount;
+				p->setDirty();
+			}
+			writing.sendError(e);
+			throw;
+		}
+		freeFast4kAligned(size, buffer);
+
+		for (auto p : pages) {
+			--p->writeThroughCount;
+			p->updateFlushableIndex();
+		}
+
+		writing.send(Void());
+
+		owner->pageCache->try_evict();
+
+		return Void();
+	}
+
 	Future<Void> flush() {
 		if (!dirty && notFlushing.isReady())
 			return Void();
@@ -37,6 +37,7 @@
 #include "flow/ActorCollection.h"
 #include "flow/Error.h"
 #include "flow/flow.h"
+#include "flow/LZCompression.h"
 #include "flow/Net2Packet.h"
 #include "flow/TDMetric.actor.h"
 #include "flow/ObjectSerializer.h"
@@ -50,6 +51,9 @@ static NetworkAddressList g_currentDeliveryPeerAddress = NetworkAddressList();
 static Future<Void> g_currentDeliveryPeerDisconnect;
 
 constexpr int PACKET_LEN_WIDTH = sizeof(uint32_t);
+// Set in the packet length word when the packet body is compressed. The body is then the uncompressed length as a
+// uint32_t followed by an LZCompression block holding the token and message.
+constexpr uint32_t PACKET_COMPRESSED_FLAG = 1U << 31;
 const uint64_t TOKEN_STREAM_FLAG = 1;
 
 FDB_BOOLEAN_PARAM(InReadSocket);
@@ -363,6 +367,8 @@ ACTOR Future<Void> pingLatencyLogger(TransportData* self) {
 				    .detail("Count", peer->pingLatencies.getPopulationSize())
 				    .detail("BytesReceived", peer->bytesReceived - peer->lastLoggedBytesReceived)
 				    .detail("BytesSent", peer->bytesSent - peer->lastLoggedBytesSent)
+				    .detail("CompressionBytesSaved",
+				            peer->compressionBytesSaved - peer->lastLoggedCompressionBytesSaved)
 				    .detail("TimeoutCount", peer->timeoutCount)
 				    .detail("ConnectOutgoingCount", peer->connectOutgoingCount)
 				    .detail("ConnectIncomingCount", peer->connectIncomingCount)
@@ -380,6 +386,7 @@ ACTOR Future<Void> pingLatencyLogger(TransportData* self) {
 				peer->connectLatencies.clear();
 				peer->lastLoggedBytesReceived = peer->bytesReceived;
 				peer->lastLoggedBytesSent = peer->bytesSent;
+				peer->lastLoggedCompressionBytesSaved = peer->compressionBytesSaved;
 				peer->timeoutCount = 0;
 				wait(delay(FLOW_KNOBS->PING_LOGGING_INTERVAL));
 			} else if (it == self->orderedAddresses.begin()) {
@@ -416,7 +423,8 @@ struct ConnectPacket {
 	// IP Address to reconnect to the originating process. Only one of these must be populated.
 	uint32_t canonicalRemoteIp4;
 
-	enum ConnectPacketFlags { FLAG_IPV6 = 1 };
+	// FLAG_COMPRESSION means the sender can receive packets with PACKET_COMPRESSED_FLAG set
+	enum ConnectPacketFlags { FLAG_IPV6 = 1, FLAG_COMPRESSION = 2 };
 	uint16_t flags;
 	uint8_t canonicalRemoteIp6[16];
 
@@ -443,6 +451,7 @@ struct ConnectPacket {
 	}
 
 	bool isIPv6() const { return flags & FLAG_IPV6; }
+	bool acceptsCompression() const { return flags & FLAG_COMPRESSION; }
 
 	uint32_t totalPacketSize() const { return connectPacketLength + sizeof(connectPacketLength); }
 
@@ -772,6 +781,7 @@ ACTOR Future<Void> connectionKeeper(Reference<Peer> self,
 			}
 
 			self->discardUnreliablePackets();
+			self->compressionSupported = false;
 			reader = Future<Void>();
 			bool ok = e.code() == error_code_connection_failed || e.code() == error_code_actor_cancelled ||
 			          e.code() == error_code_connection_unreferenced || e.code() == error_code_connection_idle ||
@@ -860,6 +870,7 @@ Peer::Peer(TransportData* transport, NetworkAddress const& destination)
     incompatibleProtocolVersionNewer(false), bytesReceived(0), bytesSent(0), lastDataPacketSentTime(now()),
     outstandingReplies(0), pingLatencies(destination.isPublic() ? FLOW_KNOBS->PING_SAMPLE_AMOUNT : 1),
     lastLoggedTime(0.0), lastLoggedBytesReceived(0), lastLoggedBytesSent(0), timeoutCount(0),
+    compressionSupported(false), compressionBytesSaved(0), lastLoggedCompressionBytesSaved(0),
     protocolVersion(Reference<AsyncVar<Optional<ProtocolVersion>>>(new AsyncVar<Optional<ProtocolVersion>>())),
     connectOutgoingCount(0), connectIncomingCount(0), connectFailedCount(0),
     connectLatencies(destination.isPublic() ? FLOW_KNOBS->NETWORK_CONNECT_SAMPLE_AMOUNT : 1) {
@@ -893,6 +904,7 @@ void Peer::prependConnectPacket() {
 	pkt.protocolVersion = g_network->protocolVersion();
 	pkt.protocolVersion.addObjectSerializerFlag();
 	pkt.connectionId = transport->transportId;
+	pkt.flags |= ConnectPacket::FLAG_COMPRESSION;
 
 	PacketBuffer* pb_first = PacketBuffer::create();
 	PacketWriter wr(pb_first, nullptr, Unversioned());
@@ -1055,6 +1067,25 @@ ACTOR static void deliver(TransportData* self,
 	}
 }
 
+// Expands the body of a packet sent with PACKET_COMPRESSED_FLAG into memory owned by arena
+static StringRef decompressPacket(Arena& arena, StringRef body, NetworkAddress const& peerAddress) {
+	uint32_t rawLen;
+	if (body.size() < sizeof(rawLen)) {
+		throw serialization_failed();
+	}
+	memcpy(&rawLen, body.begin(), sizeof(rawLen));
+	if (rawLen > FLOW_KNOBS->PACKET_LIMIT || rawLen < sizeof(UID)) {
+		TraceEvent(SevWarnAlways, "CompressedPacketInvalidLength")
+		    .detail("FromPeer", peerAddress.toString())
+		    .detail("Length", rawLen);
+		throw serialization_failed();
+	}
+
+	uint8_t* raw = new (arena) uint8_t[rawLen];
+	LZCompression::decompress(body.begin() + sizeof(rawLen), body.size() - sizeof(rawLen), raw, rawLen);
+	return StringRef(raw, rawLen);
+}
+
 static void scanPackets(TransportData* transport,
                         uint8_t*& unprocessed_begin,
                         const uint8_t* e,
@@ -1080,6 +1111,8 @@ static void scanPackets(TransportData* transport,
 			break;
 		packetLen = *(uint32_t*)p;
 		p += PACKET_LEN_WIDTH;
+		const bool compressed = packetLen & PACKET_COMPRESSED_FLAG;
+		packetLen &= ~PACKET_COMPRESSED_FLAG;
 
 		// Read checksum if present
 		if (checksumEnabled) {
@@ -1150,9 +1183,14 @@ static void scanPackets(TransportData* transport,
 #if VALGRIND
 		VALGRIND_CHECK_MEM_IS_DEFINED(p, packetLen);
 #endif
+		StringRef packet(p, packetLen);
+		if (compressed) {
+			packet = decompressPacket(arena, packet, peerAddress);
+		}
+
 		// remove object serializer flag to account for flat buffer
 		peerProtocolVersion.removeObjectSerializerFlag();
-		ArenaReader reader(arena, StringRef(p, packetLen), AssumeVersion(peerProtocolVersion));
+		ArenaReader reader(arena, packet, AssumeVersion(peerProtocolVersion));
 		UID token;
 		reader >> token;
 
@@ -1204,7 +1242,7 @@ static int getNewBufferSize(const uint8_t* begin,
 	if (len < PACKET_LEN_WIDTH) {
 		return FLOW_KNOBS->MIN_PACKET_BUFFER_BYTES;
 	}
-	const uint32_t packetLen = *(uint32_t*)begin;
+	const uint32_t packetLen = *(uint32_t*)begin & ~PACKET_COMPRESSED_FLAG;
 	if (packetLen > FLOW_KNOBS->PACKET_LIMIT) {
 		TraceEvent(SevError, "PacketLimitExceeded")
 		    .detail("FromPeer", peerAddress.toString())
@@ -1215,6 +1253,23 @@ static int getNewBufferSize(const uint8_t* begin,
 	                          packetLen + sizeof(uint32_t) * (peerAddress.isTLS() ? 2 : 3));
 }
 
+// Returns true if the packet starting at begin is at least LARGE_PACKET_BUFFER_BYTES long and will not fit between
+// begin and bufferEnd. Such a packet is moved to a buffer of its own as soon as its length is known rather than after
+// the current buffer fills up, so only the part of it read so far is copied. The rest is read directly into the
+// buffer that the deserialized message will reference, which holds no other packets.
+static bool needsOwnBuffer(const uint8_t* begin,
+                           const uint8_t* end,
+                           const uint8_t* bufferEnd,
+                           const NetworkAddress& peerAddress,
+                           ProtocolVersion peerProtocolVersion) {
+	if (end - begin < PACKET_LEN_WIDTH) {
+		return false;
+	}
+	const uint32_t packetLen = *(uint32_t*)begin & ~PACKET_COMPRESSED_FLAG;
+	return packetLen >= FLOW_KNOBS->LARGE_PACKET_BUFFER_BYTES &&
+	       bufferEnd - begin < getNewBufferSize(begin, end, peerAddress, peerProtocolVersion);
+}
+
 // This actor exists whenever there is an open or opening connection, whether incoming or outgoing
 // For incoming connections conn is set and peer is initially nullptr; for outgoing connections it is the reverse
 ACTOR static Future<Void> connectionReader(TransportData* transport,
@@ -1230,6 +1285,7 @@ ACTOR static Future<Void> connectionReader(TransportData* transport,
 	state bool compatible = false;
 	state bool incompatiblePeerCounted = false;
 	state bool incompatibleProtocolVersionNewer = false;
+	state bool acceptsCompression = false;
 	state NetworkAddress peerAddress;
 	state ProtocolVersion peerProtocolVersion;
 	state Reference<AuthorizedTenants> authorizedTenants = makeReference<AuthorizedTenants>();
@@ -1247,7 +1303,10 @@ ACTOR static Future<Void> connectionReader(TransportData* transport,
 		loop {
 			loop {
 				state int readAllBytes = buffer_end - unprocessed_end;
-				if (readAllBytes < FLOW_KNOBS->MIN_PACKET_BUFFER_FREE_BYTES) {
+				if (readAllBytes < FLOW_KNOBS->MIN_PACKET_BUFFER_FREE_BYTES ||
+				    (!expectConnectPacket &&
+				     needsOwnBuffer(
+				         unprocessed_begin, unprocessed_end, buffer_end, peerAddress, peerProtocolVersion))) {
 					Arena newArena;
 					const int unproc_len = unprocessed_end - unprocessed_begin;
 					const int len =
@@ -1264,6 +1323,7 @@ ACTOR static Future<Void> connectionReader(TransportData* transport,
 				}
 
 				state int totalReadBytes = 0;
+				state bool stoppedForLargePacket = false;
 				while (true) {
 					const int len = std::min<int>(buffer_end - unprocessed_end, FLOW_KNOBS->MAX_PACKET_SEND_BYTES);
 					if (len == 0)
@@ -1274,13 +1334,20 @@ ACTOR static Future<Void> connectionReader(TransportData* transport,
 					wait(yield(TaskPriority::ReadSocket));
 					totalReadBytes += readBytes;
 					unprocessed_end += readBytes;
+					// Stop filling this buffer once we know the next packet is going to be moved out of it
+					if (!expectConnectPacket &&
+					    needsOwnBuffer(
+					        unprocessed_begin, unprocessed_end, buffer_end, peerAddress, peerProtocolVersion)) {
+						stoppedForLargePacket = true;
+						break;
+					}
 				}
 				if (peer) {
 					peer->bytesReceived += totalReadBytes;
 				}
 				if (totalReadBytes == 0)
 					break;
-				state bool readWillBlock = totalReadBytes != readAllBytes;
+				state bool readWillBlock = totalReadBytes != readAllBytes && !stoppedForLargePacket;
 
 				if (expectConnectPacket && unprocessed_end - unprocessed_begin >= CONNECT_PACKET_V0_SIZE) {
 					// At the beginning of a connection, we expect to receive a packet containing the protocol version
@@ -1356,6 +1423,7 @@ ACTOR static Future<Void> connectionReader(TransportData* transport,
 							    .detail("PeerAddr", NetworkAddress(pkt.canonicalRemoteIp(), pkt.canonicalRemotePort));
 							peer->compatible = compatible;
 							peer->incompatibleProtocolVersionNewer = incompatibleProtocolVersionNewer;
+							peer->compressionSupported = pkt.acceptsCompression();
 							if (!compatible) {
 								peer->transport->numIncompatibleConnections++;
 								incompatiblePeerCounted = true;
@@ -1374,12 +1442,17 @@ ACTOR static Future<Void> connectionReader(TransportData* transport,
 							peer = transport->getOrOpenPeer(peerAddress, false);
 							peer->compatible = compatible;
 							peer->incompatibleProtocolVersionNewer = incompatibleProtocolVersionNewer;
+							acceptsCompression = pkt.acceptsCompression();
 							if (!compatible) {
 								peer->transport->numIncompatibleConnections++;
 								incompatiblePeerCounted = true;
 							}
 							onConnected.send(peer);
 							wait(delay(0)); // Check for cancellation
+							// Only now is this the peer's connection. Setting compressionSupported earlier would let
+							// the keeper of the connection this one replaced clear it as it is cancelled, or would
+							// apply this connection's flag to the one kept if this one is redundant.
+							peer->compressionSupported = acceptsCompression;
 						}
 						peer->protocolVersion->set(peerProtocolVersion);
 					}
@@ -1693,6 +1766,46 @@ static void sendLocal(TransportData* self, ISerializeSource const& what, const E
 	}
 }
 
+// Writes the token and message for a peer that accepts compressed packets. The object writer asks for its buffer once
+// it knows the size of the message, so a packet below PACKET_COMPRESSION_THRESHOLD bytes is serialized straight into wr
+// as usual. A larger one is serialized into a separate buffer and copied into wr either as is or, if compression makes
+// it smaller, as a compressed body. Returns true if the packet was compressed.
+static bool writeCompressiblePacket(Peer* peer, ISerializeSource const& what, UID const& token, PacketWriter& wr) {
+	Arena arena;
+	uint8_t* raw = nullptr;
+	int rawLen = 0;
+	ObjectWriter ow(
+	    [&](size_t size) -> uint8_t* {
+		    rawLen = sizeof(UID) + size;
+		    if (rawLen < FLOW_KNOBS->PACKET_COMPRESSION_THRESHOLD) {
+			    wr << token;
+			    return wr.writeBytes(size);
+		    }
+		    raw = new (arena) uint8_t[rawLen];
+		    memcpy(raw, &token, sizeof(UID));
+		    return raw + sizeof(UID);
+	    },
+	    AssumeVersion(wr.protocolVersion()));
+	what.serializeObjectWriter(ow);
+	if (raw == nullptr) {
+		return false;
+	}
+
+	uint8_t* buf = new (arena) uint8_t[LZCompression::maxCompressedSize(rawLen)];
+	const int blockLen = LZCompression::compress(raw, rawLen, buf);
+	const int bodyLen = sizeof(uint32_t) + blockLen;
+	if (bodyLen < rawLen) {
+		TEST(true); // Sending compressed packet
+		wr << (uint32_t)rawLen;
+		wr.serializeBytes(buf, blockLen);
+		peer->compressionBytesSaved += rawLen - bodyLen;
+		return true;
+	}
+
+	wr.serializeBytes(raw, rawLen);
+	return false;
+}
+
 static ReliablePacket* sendPacket(TransportData* self,
                                   Reference<Peer> peer,
                                   ISerializeSource const& what,
@@ -1738,8 +1851,15 @@ static ReliablePacket* sendPacket(TransportData* self,
 	}
 
 	wr.writeAhead(packetInfoSize, &packetInfoBuffer);
-	wr << destination.token;
-	what.serializePacketWriter(wr);
+	// Reliable packets are never compressed, because they are resent after a reconnect, possibly to a peer that does
+	// not accept compressed packets. Unreliable packets are discarded when the connection they were written for closes.
+	bool compressed = false;
+	if (!reliable && peer->compressionSupported && FLOW_KNOBS->PACKET_COMPRESSION_THRESHOLD > 0) {
+		compressed = writeCompressiblePacket(peer.getPtr(), what, destination.token, wr);
+	} else {
+		wr << destination.token;
+		what.serializePacketWriter(wr);
+	}
 	pb = wr.finish();
 	len = wr.size() - packetInfoSize;
 
@@ -1791,7 +1911,8 @@ static ReliablePacket* sendPacket(TransportData* self,
 	}
 
 	// Write packet length and checksum into packet buffer
-	packetInfoBuffer.write(&len, sizeof(len));
+	uint32_t lenWord = compressed ? (len | PACKET_COMPRESSED_FLAG) : len;
+	packetInfoBuffer.write(&lenWord, sizeof(lenWord));
 	if (checksumEnabled) {
 		packetInfoBuffer.write(&checksum, sizeof(checksum), sizeof(len));
 	}
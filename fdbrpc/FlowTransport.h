@@ -168,6 +168,9 @@ struct Peer : public ReferenceCounted<Peer> {
 	int64_t lastLoggedBytesReceived;
 	int64_t lastLoggedBytesSent;
 	int timeoutCount;
+	bool compressionSupported; // The peer accepts compressed packets on the current connection
+	int64_t compressionBytesSaved;
+	int64_t lastLoggedCompressionBytesSaved;
 
 	Reference<AsyncVar<Optional<ProtocolVersion>>> protocolVersion;
 
@@ -2409,6 +2409,13 @@ ACTOR Future<Void> commitProxyServerCore(CommitProxyInterface proxy,
 				}
 			}
 		}
+		when(CommitTransactionBatchRequest batch = waitNext(proxy.commitBatch.getFuture())) {
+			// Hand each coalesced commit to the commit batcher as though it had arrived on its own
+			++commitData.stats.coalescedCommitBatchIn;
+			for (auto& req : batch.requests) {
+				proxy.commit.send(req);
+			}
+		}
 		when(ProxySnapRequest snapReq = waitNext(proxy.proxySnapReq.getFuture())) {
 			TraceEvent(SevDebug, "SnapMasterEnqueue").log();
 			addActor.send(proxySnapCreate(snapReq, &commitData));
@@ -1266,6 +1266,7 @@ ACTOR Future<Void> dataDistributor(DataDistributorInterface di, Reference<AsyncV
 		TraceEvent("DataDistributorRunning", di.id());
 		self->addActor.send(waitFailureServer(di.waitFailure.getFuture()));
 		self->addActor.send(cacheServerWatcher(&cx));
+		self->addActor.send(secondaryIndexWriter(cx, di.id()));
 		state Future<Void> distributor =
 		    reportErrorsExcept(dataDistribution(self, getShardMetricsList, &ddEnabledState),
 		                       "DataDistribution",
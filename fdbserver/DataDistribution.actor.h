@@ -441,5 +441,8 @@ struct StorageWiggler : ReferenceCounted<StorageWiggler> {
 ACTOR Future<std::vector<std::pair<StorageServerInterface, ProcessClass>>> getServerListAndProcessClasses(
     Transaction* tr);
 
+// Keeps the secondary indexes defined under secondaryIndexKeys up to date, running one index writer per index
+ACTOR Future<Void> secondaryIndexWriter(Database cx, UID distributorId);
+
 #include "flow/unactorcompiler.h"
 #endif
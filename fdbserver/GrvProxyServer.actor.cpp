@@ -41,6 +41,7 @@ struct GrvProxyStats {
 	Counter txnDefaultPriorityStartIn, txnDefaultPriorityStartOut;
 	Counter txnThrottled;
 	Counter updatesFromRatekeeper, leaseTimeouts;
+	Counter epochLeaseHits; // GRV batches that skipped confirming the epoch with the TLogs thanks to a lease
 	int systemGRVQueueSize, defaultGRVQueueSize, batchGRVQueueSize;
 	double transactionRateAllowed, batchTransactionRateAllowed;
 	double transactionLimit, batchTransactionLimit;
@@ -102,7 +103,8 @@ struct GrvProxyStats {
 	    txnBatchPriorityStartOut("TxnBatchPriorityStartOut", cc),
 	    txnDefaultPriorityStartIn("TxnDefaultPriorityStartIn", cc),
 	    txnDefaultPriorityStartOut("TxnDefaultPriorityStartOut", cc), txnThrottled("TxnThrottled", cc),
-	    updatesFromRatekeeper("UpdatesFromRatekeeper", cc), leaseTimeouts("LeaseTimeouts", cc), systemGRVQueueSize(0),
+	    updatesFromRatekeeper("UpdatesFromRatekeeper", cc), leaseTimeouts("LeaseTimeouts", cc),
+	    epochLeaseHits("EpochLeaseHits", cc), systemGRVQueueSize(0),
 	    defaultGRVQueueSize(0), batchGRVQueueSize(0), transactionRateAllowed(0), batchTransactionRateAllowed(0),
 	    transactionLimit(0), batchTransactionLimit(0), percentageOfDefaultGRVQueueProcessed(0),
 	    percentageOfBatchGRVQueueProcessed(0), lastBatchQueueThrottled(false), lastDefaultQueueThrottled(false),
@@ -251,6 +253,8 @@ struct GrvProxyData {
 	LatencySample versionVectorSizeOnGRVReply;
 	int updateCommitRequests;
 	NotifiedDouble lastCommitTime;
+	// Until this time, the TLogs have promised not to let a recovery end the epoch
+	double epochLeaseExpiration;
 
 	Version minKnownCommittedVersion; // we should ask master for this version.
 
@@ -284,7 +288,7 @@ struct GrvProxyData {
 	                                dbgid,
 	                                SERVER_KNOBS->LATENCY_METRICS_LOGGING_INTERVAL,
 	                                SERVER_KNOBS->LATENCY_SAMPLE_SIZE),
-	    updateCommitRequests(0), lastCommitTime(0), minKnownCommittedVersion(invalidVersion) {}
+	    updateCommitRequests(0), lastCommitTime(0), epochLeaseExpiration(0), minKnownCommittedVersion(invalidVersion) {}
 };
 
 ACTOR Future<Void> healthMetricsRequestServer(GrvProxyInterface grvProxy,
@@ -515,10 +519,17 @@ ACTOR Future<Void> updateLastCommit(GrvProxyData* self, Optional<UID> debugID =
 	state double confirmStart = now();
 	self->lastStartCommit = confirmStart;
 	self->updateCommitRequests++;
-	wait(self->logSystem->confirmEpochLive(debugID));
+	wait(self->logSystem->confirmEpochLive(debugID, SERVER_KNOBS->GRV_LEASE_DURATION));
 	self->updateCommitRequests--;
 	self->lastCommitLatency = now() - confirmStart;
 	self->lastCommitTime = std::max(self->lastCommitTime.get(), confirmStart);
+	if (SERVER_KNOBS->GRV_LEASE_DURATION > 0) {
+		// The TLogs measured the lease from when they received the request, which was after confirmStart. Allow for
+		// the clocks of this process and of the TLogs running at different rates.
+		self->epochLeaseExpiration =
+		    std::max(self->epochLeaseExpiration,
+		             confirmStart + SERVER_KNOBS->GRV_LEASE_DURATION * (1 - 2 * SERVER_KNOBS->GRV_LEASE_CLOCK_DRIFT));
+	}
 	return Void();
 }
 
@@ -526,6 +537,12 @@ ACTOR Future<Void> lastCommitUpdater(GrvProxyData* self, PromiseStream<Future<Vo
 	loop {
 		double interval = std::max(SERVER_KNOBS->MIN_CONFIRM_INTERVAL,
 		                           (SERVER_KNOBS->REQUIRED_MIN_RECOVERY_DURATION - self->lastCommitLatency) / 2.0);
+		if (SERVER_KNOBS->GRV_LEASE_DURATION > 0) {
+			// Renew the lease well before it runs out, so that GRV batches rarely have to confirm the epoch themselves,
+			// but no more often than MIN_CONFIRM_INTERVAL allows even if the lease is very short
+			interval = std::max(SERVER_KNOBS->MIN_CONFIRM_INTERVAL,
+			                    std::min(interval, SERVER_KNOBS->GRV_LEASE_DURATION / 4));
+		}
 		double elapsed = now() - self->lastStartCommit;
 		if (elapsed < interval) {
 			wait(delay(interval + 0.0001 - elapsed));
@@ -564,7 +581,11 @@ ACTOR Future<GetReadVersionReply> getLiveCommittedVersion(SpanID parentSpan,
 	    GetRawCommittedVersionRequest(span.context, debugID, grvProxyData->ssVersionVectorCache.getMaxVersion()),
 	    TaskPriority::GetLiveCommittedVersionReply);
 
-	if (!SERVER_KNOBS->ALWAYS_CAUSAL_READ_RISKY && !(flags & GetReadVersionRequest::FLAG_CAUSAL_READ_RISKY)) {
+	if (SERVER_KNOBS->GRV_LEASE_DURATION > 0 && grvStart < grvProxyData->epochLeaseExpiration) {
+		// No recovery can have ended the epoch while the lease holds, so no other generation can have committed a
+		// version newer than the one the master returns
+		++grvProxyData->stats.epochLeaseHits;
+	} else if (!SERVER_KNOBS->ALWAYS_CAUSAL_READ_RISKY && !(flags & GetReadVersionRequest::FLAG_CAUSAL_READ_RISKY)) {
 		wait(updateLastCommit(grvProxyData, debugID));
 	} else if (SERVER_KNOBS->REQUIRED_MIN_RECOVERY_DURATION > 0 &&
 	           now() - SERVER_KNOBS->REQUIRED_MIN_RECOVERY_DURATION > grvProxyData->lastCommitTime.get()) {
@@ -1009,7 +1030,7 @@ ACTOR Future<Void> grvProxyServerCore(GrvProxyInterface proxy,
 	    proxy, grvProxyData.db, addActor, &grvProxyData, &healthMetricsReply, &detailedHealthMetricsReply));
 	addActor.send(healthMetricsRequestServer(proxy, &healthMetricsReply, &detailedHealthMetricsReply));
 
-	if (SERVER_KNOBS->REQUIRED_MIN_RECOVERY_DURATION > 0) {
+	if (SERVER_KNOBS->REQUIRED_MIN_RECOVERY_DURATION > 0 || SERVER_KNOBS->GRV_LEASE_DURATION > 0) {
 		addActor.send(lastCommitUpdater(&grvProxyData, addActor));
 	}
 
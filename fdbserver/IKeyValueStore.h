@@ -112,6 +112,12 @@ public:
 	// Delete a checkpoint.
 	virtual Future<Void> deleteCheckpoint(const CheckpointMetaData& checkpoint) { throw not_implemented(); }
 
+	// Load a stream of batches of sorted key/value pairs, ending with end_of_stream, as if each were set(). A store
+	// that is empty and has no uncommitted writes may build its on-disk structures directly from the input and commit
+	// them. Otherwise the pairs are made durable by the next commit(), like any other set().
+	virtual Future<Void> bulkLoad(FutureStream<Standalone<VectorRef<KeyValueRef>>> data) { throw not_implemented(); }
+	virtual bool supportsBulkLoad() const { return false; }
+
 	/*
 	Concurrency contract
 	    Causal consistency:
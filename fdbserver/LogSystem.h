@@ -581,8 +581,9 @@ struct ILogSystem {
 	// Permits, but does not require, the log subsystem to strip `tag` from any or all messages with message versions <
 	// (upTo,0) The popping of any given message may be arbitrarily delayed.
 
-	virtual Future<Void> confirmEpochLive(Optional<UID> debugID = Optional<UID>()) = 0;
-	// Returns success after confirming that pushes in the current epoch are still possible
+	virtual Future<Void> confirmEpochLive(Optional<UID> debugID = Optional<UID>(), double leaseDuration = 0) = 0;
+	// Returns success after confirming that pushes in the current epoch are still possible. If leaseDuration is
+	// positive, the epoch also cannot end until leaseDuration seconds after the call (as measured by the TLogs).
 
 	virtual Future<Void> endEpoch() = 0;
 	// Ends the current epoch without starting a new one
@@ -0,0 +1,289 @@
+/*
+ * SecondaryIndexWriter.actor.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <deque>
+
+#include "fdbclient/DatabaseContext.h"
+#include "fdbclient/NativeAPI.actor.h"
+#include "fdbclient/SecondaryIndex.h"
+#include "fdbclient/SystemData.h"
+#include "fdbserver/DataDistribution.actor.h"
+#include "fdbserver/Knobs.h"
+#include "flow/actorcompiler.h" // This must be the last #include.
+
+// The index writer keeps no state of its own besides its progress version. Whenever a record changes, it makes the
+// index entries of the changed records match the records as they are when its transaction reads them, using the entry
+// references under secondaryIndexEntryKeys to find the entries to clear. Applying a change more than once, or after
+// later changes to the same records, is therefore harmless, which is what lets the writer restart from its last
+// progress version at any time.
+
+// Makes the index entries of the records in a range match the records, given the records and the entry references of
+// the range as read by tr
+static void updateIndexEntries(Transaction* tr,
+                               SecondaryIndexDefinition const& definition,
+                               KeyRef entryPrefix,
+                               VectorRef<KeyValueRef> records,
+                               VectorRef<KeyValueRef> entries) {
+	std::map<KeyRef, Key> wanted;
+	for (auto& record : records) {
+		Optional<Key> entry = definition.indexEntryFor(record.key, record.value);
+		if (entry.present()) {
+			wanted[record.key] = entry.get();
+		}
+	}
+	for (auto& reference : entries) {
+		KeyRef recordKey = reference.key.removePrefix(entryPrefix);
+		auto it = wanted.find(recordKey);
+		if (it != wanted.end() && it->second == reference.value) {
+			wanted.erase(it);
+			continue;
+		}
+		tr->clear(reference.value);
+		if (it == wanted.end()) {
+			tr->clear(reference.key);
+		}
+	}
+	for (auto& [recordKey, entry] : wanted) {
+		tr->set(entry, ""_sr);
+		tr->set(recordKey.withPrefix(entryPrefix), entry);
+	}
+}
+
+// Returns the rows whose keys are less than end
+static VectorRef<KeyValueRef> rowsBefore(VectorRef<KeyValueRef> rows, KeyRef end) {
+	auto it = std::lower_bound(
+	    rows.begin(), rows.end(), end, [](KeyValueRef const& row, KeyRef const& key) { return row.key < key; });
+	return VectorRef<KeyValueRef>(rows.begin(), it - rows.begin());
+}
+
+// Reads the index's definition in tr, so that tr conflicts with the index being dropped or redefined, and returns
+// whether the index still has the given definition
+ACTOR static Future<bool> definitionUnchanged(Transaction* tr, Key name, SecondaryIndexDefinition definition) {
+	Optional<Value> value = wait(tr->get(name.withPrefix(secondaryIndexKeys.begin)));
+	return value.present() && decodeSecondaryIndexDefinition(value.get()) == definition;
+}
+
+// Updates the index entries of the records in ranges, and records progress as the index's progress in the transaction
+// that finishes them. Each transaction reads about SECONDARY_INDEX_BATCH_SIZE records and entry references at most, so
+// a large range is split across several transactions. Returns false, without committing anything more, once the index
+// has been dropped or redefined.
+ACTOR static Future<bool> indexRanges(Database cx,
+                                      Key name,
+                                      SecondaryIndexDefinition definition,
+                                      std::deque<KeyRange> ranges,
+                                      Version progress) {
+	state Key entryPrefix = secondaryIndexEntryPrefixFor(name);
+	state Transaction tr(cx);
+	loop {
+		state int count = std::min<int>(ranges.size(), SERVER_KNOBS->SECONDARY_INDEX_BATCH_SIZE);
+		state std::vector<Future<RangeResult>> records;
+		state std::vector<Future<RangeResult>> entries;
+		state std::vector<KeyRange> rest;
+		state bool done = false;
+		try {
+			tr.setOption(FDBTransactionOptions::ACCESS_SYSTEM_KEYS);
+			tr.setOption(FDBTransactionOptions::LOCK_AWARE);
+			records.clear();
+			entries.clear();
+			rest.clear();
+			bool unchanged = wait(definitionUnchanged(&tr, name, definition));
+			if (!unchanged) {
+				return false;
+			}
+
+			int limit = std::max(1, SERVER_KNOBS->SECONDARY_INDEX_BATCH_SIZE / std::max(count, 1));
+			for (int i = 0; i < count; i++) {
+				records.push_back(tr.getRange(ranges[i], limit));
+				KeyRange entryRange =
+				    KeyRangeRef(ranges[i].begin.withPrefix(entryPrefix), ranges[i].end.withPrefix(entryPrefix));
+				entries.push_back(tr.getRange(entryRange, limit));
+			}
+			wait(waitForAll(records) && waitForAll(entries));
+
+			// Only the part of a range whose records and entry references were both read completely is updated. The
+			// rest is left for a later transaction, which is safe because updating a range is idempotent.
+			for (int i = 0; i < count; i++) {
+				RangeResult const& rangeRecords = records[i].get();
+				RangeResult const& rangeEntries = entries[i].get();
+				Key end = ranges[i].end;
+				if (rangeRecords.more) {
+					end = rangeRecords.empty() ? ranges[i].begin
+					                           : std::min(end, keyAfter(rangeRecords.back().key));
+				}
+				if (rangeEntries.more) {
+					end = rangeEntries.empty()
+					          ? ranges[i].begin
+					          : std::min(end, keyAfter(rangeEntries.back().key.removePrefix(entryPrefix)));
+				}
+				updateIndexEntries(&tr,
+				                   definition,
+				                   entryPrefix,
+				                   rowsBefore(rangeRecords, end),
+				                   rowsBefore(rangeEntries, end.withPrefix(entryPrefix)));
+				if (end < ranges[i].end) {
+					rest.push_back(KeyRangeRef(end, ranges[i].end));
+				}
+			}
+
+			done = rest.empty() && count == (int)ranges.size();
+			if (done) {
+				tr.set(secondaryIndexProgressKeyFor(name), BinaryWriter::toValue(progress, Unversioned()));
+			}
+			wait(tr.commit());
+			if (done) {
+				return true;
+			}
+			ranges.erase(ranges.begin(), ranges.begin() + count);
+			ranges.insert(ranges.begin(), rest.begin(), rest.end());
+			tr.reset();
+		} catch (Error& e) {
+			wait(tr.onError(e));
+		}
+	}
+}
+
+// Writes the index entries of the records that existed before the index was created. Returns the version from which
+// the change feed has to be applied afterwards, or an empty Optional if the index has been dropped or redefined.
+ACTOR static Future<Optional<Version>> backfillIndex(Database cx, Key name, SecondaryIndexDefinition definition) {
+	state Version startVersion;
+	state Transaction tr(cx);
+	loop {
+		try {
+			tr.setOption(FDBTransactionOptions::LOCK_AWARE);
+			Version readVersion = wait(tr.getReadVersion());
+			startVersion = readVersion;
+			break;
+		} catch (Error& e) {
+			wait(tr.onError(e));
+		}
+	}
+
+	// Every backfill transaction reads at or after startVersion, so the change feed from startVersion covers every
+	// change the backfill might have missed
+	bool indexed =
+	    wait(indexRanges(cx, name, definition, std::deque<KeyRange>{ definition.recordRange() }, startVersion));
+	if (!indexed) {
+		return Optional<Version>();
+	}
+	TraceEvent("SecondaryIndexBackfilled").detail("Name", name).detail("Version", startVersion);
+	return startVersion;
+}
+
+// Keeps one index up to date by applying the change feed on its record range
+ACTOR static Future<Void> maintainSecondaryIndex(Database cx, Key name, SecondaryIndexDefinition definition) {
+	state Key feedId = secondaryIndexFeedIdFor(name);
+	loop {
+		try {
+			state Optional<Value> progress;
+			state Transaction tr(cx);
+			loop {
+				try {
+					tr.setOption(FDBTransactionOptions::ACCESS_SYSTEM_KEYS);
+					tr.setOption(FDBTransactionOptions::LOCK_AWARE);
+					Optional<Value> value = wait(tr.get(secondaryIndexProgressKeyFor(name)));
+					progress = value;
+					break;
+				} catch (Error& e) {
+					wait(tr.onError(e));
+				}
+			}
+			state Version begin;
+			if (progress.present()) {
+				begin = BinaryReader::fromStringRef<Version>(progress.get(), Unversioned());
+			} else {
+				Optional<Version> backfilled = wait(backfillIndex(cx, name, definition));
+				if (!backfilled.present()) {
+					TraceEvent("SecondaryIndexWriterStopped").detail("Name", name);
+					return Void();
+				}
+				begin = backfilled.get();
+			}
+
+			state Reference<ChangeFeedData> feed = makeReference<ChangeFeedData>();
+			state Future<Void> stream = cx->getChangeFeedStream(
+			    feed, feedId, begin, std::numeric_limits<Version>::max(), definition.recordRange());
+			loop {
+				Standalone<VectorRef<MutationsAndVersionRef>> batch = waitNext(feed->mutations.getFuture());
+				if (batch.empty()) {
+					continue;
+				}
+				std::deque<KeyRange> changed;
+				for (auto& it : batch) {
+					for (auto& m : it.mutations) {
+						if (m.type == MutationRef::SetValue && m.param1 != lastEpochEndPrivateKey) {
+							changed.push_back(singleKeyRange(m.param1));
+						} else if (m.type == MutationRef::ClearRange) {
+							changed.push_back(KeyRangeRef(m.param1, m.param2));
+						}
+					}
+				}
+				state Version end = batch.back().version + 1;
+				bool indexed = wait(indexRanges(cx, name, definition, changed, end));
+				if (!indexed) {
+					TraceEvent("SecondaryIndexWriterStopped").detail("Name", name);
+					return Void();
+				}
+				begin = end;
+				wait(cx->popChangeFeedMutations(feedId, begin));
+			}
+		} catch (Error& e) {
+			if (e.code() == error_code_actor_cancelled) {
+				throw;
+			}
+			TraceEvent(SevWarn, "SecondaryIndexWriterError").errorUnsuppressed(e).detail("Name", name);
+			wait(delay(SERVER_KNOBS->SECONDARY_INDEX_RETRY_DELAY));
+		}
+	}
+}
+
+ACTOR Future<Void> secondaryIndexWriter(Database cx, UID distributorId) {
+	state std::map<Key, std::pair<SecondaryIndexDefinition, Future<Void>>> writers;
+	state Transaction tr(cx);
+	loop {
+		try {
+			tr.setOption(FDBTransactionOptions::ACCESS_SYSTEM_KEYS);
+			tr.setOption(FDBTransactionOptions::LOCK_AWARE);
+			RangeResult indexes = wait(tr.getRange(secondaryIndexKeys, CLIENT_KNOBS->TOO_MANY));
+			ASSERT(!indexes.more);
+
+			std::map<Key, std::pair<SecondaryIndexDefinition, Future<Void>>> current;
+			for (auto& index : indexes) {
+				Key name = index.key.removePrefix(secondaryIndexKeys.begin);
+				SecondaryIndexDefinition definition = decodeSecondaryIndexDefinition(index.value);
+				auto it = writers.find(name);
+				if (it != writers.end() && it->second.first == definition) {
+					current[name] = it->second;
+				} else {
+					TraceEvent("SecondaryIndexWriterStart", distributorId).detail("Name", name);
+					current[name] = std::make_pair(definition, maintainSecondaryIndex(cx, name, definition));
+				}
+			}
+			// Writers of dropped indexes are cancelled when they are no longer referenced
+			writers = std::move(current);
+
+			state Future<Void> changed = tr.watch(secondaryIndexChangeKey);
+			wait(tr.commit());
+			wait(changed);
+			tr.reset();
+		} catch (Error& e) {
+			wait(tr.onError(e));
+		}
+	}
+}
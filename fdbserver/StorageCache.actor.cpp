@@ -622,6 +622,61 @@ GetKeyValuesReply readRange(StorageCacheData* data, Version version, KeyRangeRef
 	return result;
 }
 
+// Reads the rows of range that match filter, in batches of RANGE_READ_FILTER_BATCH_ROWS, like readRangeFiltered in the
+// storage server. The reply is also sent once RANGE_READ_FILTER_SCAN_BYTES have been read, with lastScannedKey telling
+// the client where to continue.
+GetKeyValuesReply readRangeFiltered(StorageCacheData* data,
+                                    Version version,
+                                    KeyRangeRef range,
+                                    int limit,
+                                    int* pLimitBytes,
+                                    RangeReadFilterRef const& filter) {
+	GetKeyValuesReply result;
+	int sign = limit >= 0 ? 1 : -1;
+	int64_t scannedBytes = 0;
+	ASSERT(limit != 0 && *pLimitBytes > 0);
+
+	loop {
+		int scanLimitBytes = SERVER_KNOBS->RANGE_READ_FILTER_SCAN_BYTES - scannedBytes;
+		GetKeyValuesReply batch =
+		    readRange(data, version, range, sign * SERVER_KNOBS->RANGE_READ_FILTER_BATCH_ROWS, &scanLimitBytes);
+		result.arena.dependsOn(batch.arena);
+
+		int i = 0;
+		for (; i < batch.data.size() && limit != 0 && *pLimitBytes > 0; i++) {
+			const KeyValueRef& kv = batch.data[i];
+			int size = sizeof(KeyValueRef) + kv.expectedSize();
+			scannedBytes += size;
+			if (filter.matches(kv.key, kv.value)) {
+				result.data.push_back(result.arena, kv);
+				limit -= sign;
+				*pLimitBytes -= size;
+			} else {
+				result.filteredBytes += size;
+			}
+		}
+
+		if (i == batch.data.size() && !batch.more) {
+			result.more = false;
+			break;
+		}
+		KeyRef lastScanned = batch.data[i - 1].key;
+		if (i < batch.data.size() || limit == 0 || *pLimitBytes <= 0 ||
+		    scannedBytes >= SERVER_KNOBS->RANGE_READ_FILTER_SCAN_BYTES) {
+			result.more = true;
+			result.lastScannedKey = lastScanned;
+			break;
+		}
+
+		range = sign > 0 ? KeyRangeRef(keyAfter(lastScanned, result.arena), range.end)
+		                 : KeyRangeRef(range.begin, lastScanned);
+	}
+
+	result.version = version;
+	result.cached = true;
+	return result;
+}
+
 Key findKey(StorageCacheData* data, KeySelectorRef sel, Version version, KeyRange range, int* pOffset)
 // Attempts to find the key indicated by sel in the data at version, within range.
 // Precondition: selectorInRange(sel, range)
@@ -809,7 +864,11 @@ ACTOR Future<Void> getKeyValues(StorageCacheData* data, GetKeyValuesRequest req)
 		} else {
 			state int remainingLimitBytes = req.limitBytes;
 
-			GetKeyValuesReply _r = readRange(data, version, KeyRangeRef(begin, end), req.limit, &remainingLimitBytes);
+			GetKeyValuesReply _r =
+			    req.filter.present()
+			        ? readRangeFiltered(
+			              data, version, KeyRangeRef(begin, end), req.limit, &remainingLimitBytes, req.filter.get())
+			        : readRange(data, version, KeyRangeRef(begin, end), req.limit, &remainingLimitBytes);
 			GetKeyValuesReply r = _r;
 
 			if (req.debugID.present())
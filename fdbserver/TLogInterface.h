@@ -145,13 +145,17 @@ struct TLogConfirmRunningRequest {
 	constexpr static FileIdentifier file_identifier = 10929130;
 	Optional<UID> debugID;
 	ReplyPromise<Void> reply;
+	// If positive, a successful reply also promises that the TLog will not be locked by a recovery for this many
+	// seconds after it received the request
+	double leaseDuration = 0;
 
 	TLogConfirmRunningRequest() {}
-	TLogConfirmRunningRequest(Optional<UID> debugID) : debugID(debugID) {}
+	TLogConfirmRunningRequest(Optional<UID> debugID, double leaseDuration = 0)
+	  : debugID(debugID), leaseDuration(leaseDuration) {}
 
 	template <class Ar>
 	void serialize(Ar& ar) {
-		serializer(ar, debugID, reply);
+		serializer(ar, debugID, reply, leaseDuration);
 	}
 };
 
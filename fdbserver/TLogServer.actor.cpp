@@ -504,6 +504,12 @@ struct LogData : NonCopyable, public ReferenceCounted<LogData> {
 	bool stopped, initialized;
 	DBRecoveryCount recoveryCount;
 
+	// Until this time, tLogLock waits before stopping this generation, because a GRV proxy may be serving read
+	// versions on the strength of a lease granted by a TLogConfirmRunningRequest. Once a lock is pending, no further
+	// leases are granted.
+	double leaseExpiration;
+	bool lockPending;
+
 	// If persistentDataVersion != persistentDurableDataVersion,
 	// then spilling is happening from persistentDurableDataVersion to persistentDataVersion.
 	// Data less than persistentDataDurableVersion is spilled on disk (or fully popped from the TLog);
@@ -658,6 +664,11 @@ struct LogData : NonCopyable, public ReferenceCounted<LogData> {
 		          context);
 		addActor.send(traceRole(Role::TRANSACTION_LOG, interf.id()));
 
+		// Leases granted before a restart are forgotten, so a generation honors the longest possible lease from the
+		// time it is created
+		leaseExpiration = SERVER_KNOBS->GRV_LEASE_DURATION > 0 ? now() + SERVER_KNOBS->GRV_LEASE_DURATION : 0;
+		lockPending = false;
+
 		persistentDataVersion.init(LiteralStringRef("TLog.PersistentDataVersion"), cc.id);
 		persistentDataDurableVersion.init(LiteralStringRef("TLog.PersistentDataDurableVersion"), cc.id);
 		version.initMetric(LiteralStringRef("TLog.Version"), cc.id);
@@ -802,6 +813,13 @@ void TLogQueue::updateVersionSizes(const TLogQueueEntry& result,
 }
 
 ACTOR Future<Void> tLogLock(TLogData* self, ReplyPromise<TLogLockResult> reply, Reference<LogData> logData) {
+	logData->lockPending = true;
+	if (logData->leaseExpiration > now()) {
+		TEST(true); // TLog lock waiting for GRV lease to expire
+		TraceEvent("TLogStopWaitingForLease", logData->logId).detail("Remaining", logData->leaseExpiration - now());
+		wait(delay(logData->leaseExpiration - now()));
+	}
+
 	state Version stopVersion = logData->version.get();
 
 	TEST(true); // TLog stopped by recovering cluster-controller
@@ -2664,9 +2682,17 @@ ACTOR Future<Void> serveTLogInterface(TLogData* self,
 				g_traceBatch.addAttach("TransactionAttachID", req.debugID.get().first(), tlogDebugID.first());
 				g_traceBatch.addEvent("TransactionDebug", tlogDebugID.first(), "TLogServer.TLogConfirmRunningRequest");
 			}
-			if (!logData->stopped)
+			if (!logData->stopped && !logData->lockPending) {
+				if (req.leaseDuration > 0) {
+					// In simulation, make this TLog's clock run fast by up to the drift GRV proxies allow for
+					double leaseDuration = req.leaseDuration;
+					if (g_network->isSimulated() && BUGGIFY_WITH_PROB(0.1)) {
+						leaseDuration /= 1 + deterministicRandom()->random01() * SERVER_KNOBS->GRV_LEASE_CLOCK_DRIFT;
+					}
+					logData->leaseExpiration = std::max(logData->leaseExpiration, now() + leaseDuration);
+				}
 				req.reply.send(Void());
-			else
+			} else
 				req.reply.sendError(tlog_stopped());
 		}
 		when(TLogDisablePopRequest req = waitNext(tli.disablePopRequest.getFuture())) {
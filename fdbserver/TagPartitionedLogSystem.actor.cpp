@@ -1534,13 +1534,15 @@ Future<Version> TagPartitionedLogSystem::getTxsPoppedVersion() {
 	return getPoppedTxs(this);
 }
 
-ACTOR Future<Void> TagPartitionedLogSystem::confirmEpochLive_internal(Reference<LogSet> logSet, Optional<UID> debugID) {
+ACTOR Future<Void> TagPartitionedLogSystem::confirmEpochLive_internal(Reference<LogSet> logSet,
+                                                                      Optional<UID> debugID,
+                                                                      double leaseDuration) {
 	state std::vector<Future<Void>> alive;
 	int numPresent = 0;
 	for (auto& t : logSet->logServers) {
 		if (t->get().present()) {
 			alive.push_back(brokenPromiseToNever(t->get().interf().confirmRunning.getReply(
-			    TLogConfirmRunningRequest(debugID), TaskPriority::TLogConfirmRunningReply)));
+			    TLogConfirmRunningRequest(debugID, leaseDuration), TaskPriority::TLogConfirmRunningReply)));
 			numPresent++;
 		} else {
 			alive.push_back(Never());
@@ -1580,11 +1582,11 @@ ACTOR Future<Void> TagPartitionedLogSystem::confirmEpochLive_internal(Reference<
 	}
 }
 
-Future<Void> TagPartitionedLogSystem::confirmEpochLive(Optional<UID> debugID) {
+Future<Void> TagPartitionedLogSystem::confirmEpochLive(Optional<UID> debugID, double leaseDuration) {
 	std::vector<Future<Void>> quorumResults;
 	for (auto& it : tLogs) {
 		if (it->isLocal && it->logServers.size()) {
-			quorumResults.push_back(confirmEpochLive_internal(it, debugID));
+			quorumResults.push_back(confirmEpochLive_internal(it, debugID, leaseDuration));
 		}
 	}
 
@@ -254,10 +254,12 @@ struct TagPartitionedLogSystem final : ILogSystem, ReferenceCounted<TagPartition
 
 	Future<Version> getTxsPoppedVersion() final;
 
-	ACTOR static Future<Void> confirmEpochLive_internal(Reference<LogSet> logSet, Optional<UID> debugID);
+	ACTOR static Future<Void> confirmEpochLive_internal(Reference<LogSet> logSet,
+	                                                    Optional<UID> debugID,
+	                                                    double leaseDuration);
 
 	// Returns success after confirming that pushes in the current epoch are still possible
-	Future<Void> confirmEpochLive(Optional<UID> debugID) final;
+	Future<Void> confirmEpochLive(Optional<UID> debugID, double leaseDuration) final;
 
 	Future<Void> endEpoch() final;
 
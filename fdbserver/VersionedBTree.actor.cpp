@@ -1655,6 +1655,10 @@ struct RedwoodMetrics {
 		unsigned int pagerEvictFail;
 		unsigned int btreeLeafPreload;
 		unsigned int btreeLeafPreloadExt;
+		unsigned int btreeFilterNegative;
+		unsigned int btreeFilterPositive;
+		unsigned int btreeFilterFalsePositive;
+		unsigned int btreeFilterBuild;
 	};
 
 	RedwoodMetrics() {
@@ -5317,6 +5321,14 @@ public:
 
 	Future<Void> clearAllAndCheckSanity() { return clearAllAndCheckSanity_impl(this); }
 
+	// False if bulkBuild() is known to refuse, without waiting for the commits in progress
+	bool mayBulkBuild() const { return m_mutationCount == 0 && m_header.height == 1; }
+
+	// Build the tree from sorted input and commit it at version v, see bulkBuild_impl()
+	Future<bool> bulkBuild(FutureStream<Standalone<VectorRef<KeyValueRef>>> input, Version v) {
+		return bulkBuild_impl(this, input, v);
+	}
+
 private:
 	// Represents a change to a single key - set, clear, or atomic op
 	struct SingleKeyMutation {
@@ -5559,6 +5571,126 @@ private:
 	Future<int> m_lazyClearActor;
 	bool m_lazyClearStop;
 
+	// Bloom filter over the keys of a leaf page, used by point reads to avoid reading leaves which cannot contain
+	// the key being sought.  Filters are kept in memory only, separately from the page cache, so they are much
+	// cheaper to keep around than the leaves themselves.
+	struct LeafFilter {
+		LeafFilter(int numKeys, int bitsPerKey, Version version)
+		  : version(version), bits((std::max(numKeys * bitsPerKey, 64) + 63) / 64, 0),
+		    hashes(std::max(1, (int)(bitsPerKey * 0.69))) {}
+
+		// Snapshot version the filter was built from.  Its keys are valid for any snapshot at or after this
+		// version until the leaf is invalidated.
+		Version version;
+		std::vector<uint64_t> bits;
+		int hashes;
+
+		template <typename F>
+		void forEachBit(KeyRef key, F f) const {
+			uint64_t h = XXH3_64bits(key.begin(), key.size());
+			uint64_t delta = (h >> 33) | (h << 31);
+			uint64_t size = bits.size() * 64;
+			for (int i = 0; i < hashes; ++i) {
+				f(h % size);
+				h += delta;
+			}
+		}
+
+		void add(KeyRef key) {
+			forEachBit(key, [&](uint64_t b) { bits[b / 64] |= (uint64_t)1 << (b % 64); });
+		}
+
+		bool mayContain(KeyRef key) const {
+			bool r = true;
+			forEachBit(key, [&](uint64_t b) { r = r && (bits[b / 64] & ((uint64_t)1 << (b % 64))) != 0; });
+			return r;
+		}
+
+		int64_t bytes() const { return sizeof(LeafFilter) + bits.size() * sizeof(uint64_t); }
+	};
+
+	// Leaf filters by the leaf's first LogicalPageID
+	std::unordered_map<LogicalPageID, LeafFilter> m_leafFilters;
+	int64_t m_leafFilterBytes = 0;
+
+	// Version at which each recently written or freed leaf was changed.  A filter built from a snapshot older
+	// than this must not be stored.  Entries are removed once no snapshot older than the change can exist.
+	std::unordered_map<LogicalPageID, Version> m_leafFilterInvalidations;
+
+	// Result of checking the leaf filter for a point read
+	enum class LeafFilterResult { None, Negative, Positive };
+
+	LeafFilterResult checkLeafFilter(LogicalPageID leaf, Version snapshotVersion, KeyRef key) const {
+		auto i = m_leafFilters.find(leaf);
+		if (i == m_leafFilters.end() || snapshotVersion < i->second.version) {
+			return LeafFilterResult::None;
+		}
+		if (i->second.mayContain(key)) {
+			++g_redwoodMetrics.metric.btreeFilterPositive;
+			return LeafFilterResult::Positive;
+		}
+		++g_redwoodMetrics.metric.btreeFilterNegative;
+		return LeafFilterResult::Negative;
+	}
+
+	// Build a filter for a leaf read at snapshotVersion from a cursor into its page
+	void buildLeafFilter(LogicalPageID leaf, Version snapshotVersion, const BTreePage::BinaryTree::Cursor& leafCursor) {
+		int64_t maxBytes = SERVER_KNOBS->REDWOOD_POINT_READ_FILTER_BYTES;
+		if (maxBytes <= 0 || m_leafFilters.count(leaf)) {
+			return;
+		}
+		auto inv = m_leafFilterInvalidations.find(leaf);
+		if (inv != m_leafFilterInvalidations.end() && inv->second > snapshotVersion) {
+			return;
+		}
+
+		LeafFilter filter(
+		    leafCursor.tree->numItems, SERVER_KNOBS->REDWOOD_POINT_READ_FILTER_BITS_PER_KEY, snapshotVersion);
+		BTreePage::BinaryTree::Cursor c = leafCursor;
+		if (c.moveFirst()) {
+			do {
+				filter.add(c.get().key);
+			} while (c.moveNext());
+		}
+
+		// Make room by evicting arbitrary filters
+		while (!m_leafFilters.empty() && m_leafFilterBytes + filter.bytes() > maxBytes) {
+			auto i = m_leafFilters.begin();
+			m_leafFilterBytes -= i->second.bytes();
+			m_leafFilters.erase(i);
+		}
+		if (m_leafFilterBytes + filter.bytes() <= maxBytes) {
+			m_leafFilterBytes += filter.bytes();
+			m_leafFilters.emplace(leaf, std::move(filter));
+			++g_redwoodMetrics.metric.btreeFilterBuild;
+		}
+	}
+
+	// Called for every leaf written or freed at version v
+	void invalidateLeafFilter(BTreeNodeLinkRef id, Version v) {
+		if (SERVER_KNOBS->REDWOOD_POINT_READ_FILTER_BYTES <= 0 || id.empty()) {
+			return;
+		}
+		auto i = m_leafFilters.find(id.front());
+		if (i != m_leafFilters.end()) {
+			m_leafFilterBytes -= i->second.bytes();
+			m_leafFilters.erase(i);
+		}
+		Version& inv = m_leafFilterInvalidations[id.front()];
+		inv = std::max(inv, v);
+	}
+
+	// Forget invalidations which no longer readable snapshots could be affected by
+	void pruneLeafFilterInvalidations(Version oldestReadableVersion) {
+		for (auto i = m_leafFilterInvalidations.begin(); i != m_leafFilterInvalidations.end();) {
+			if (i->second <= oldestReadableVersion) {
+				i = m_leafFilterInvalidations.erase(i);
+			} else {
+				++i;
+			}
+		}
+	}
+
 	// Describes a range of a vector of records that should be built into a single BTreePage
 	struct PageToBuild {
 		PageToBuild(int index, int blockSize, EncodingType t)
@@ -5925,6 +6057,10 @@ private:
 				self->m_pBoundaryVerifier->update(childPageID, v, pageLowerBound.key, pageUpperBound.key);
 			}
 
+			if (height == 1) {
+				self->invalidateLeafFilter(childPageID, v);
+			}
+
 			if (++sinceYield > 100) {
 				sinceYield = 0;
 				wait(yield());
@@ -5981,6 +6117,185 @@ private:
 		return records;
 	}
 
+	// One level of a tree being built bottom-up by bulkBuild(), starting with the leaf level
+	struct BulkBuildLevel {
+		// Records which have not been written to pages yet
+		Standalone<VectorRef<RedwoodRecordRef>> pending;
+		// Key and value bytes of the records in pending
+		int64_t pendingBytes = 0;
+		// Number of times pending records have been written out to pages
+		int flushes = 0;
+	};
+
+	// Writes the pending records at the given height to pages and appends links to the new pages to the level
+	// above.  Unless lastBatch is set, the last pending record is held back to be the upper boundary of the pages
+	// written and becomes the first pending record of the next batch at this level.
+	ACTOR static Future<Void> bulkBuildFlushLevel(VersionedBTree* self,
+	                                              std::vector<BulkBuildLevel>* levels,
+	                                              int height,
+	                                              Version v,
+	                                              bool lastBatch) {
+		if (levels->size() == height) {
+			levels->emplace_back();
+		}
+		state BulkBuildLevel* level = &(*levels)[height - 1];
+		state BulkBuildLevel* parent = &(*levels)[height];
+		state Standalone<VectorRef<RedwoodRecordRef>> entries = level->pending;
+		state int count = lastBatch ? entries.size() : entries.size() - 1;
+		ASSERT(count > 0);
+
+		// The first leaf pages start at the beginning of the keyspace, every other batch of pages at any level starts
+		// at its first record.  Internal levels will always start with a link whose key is dbBegin.
+		state RedwoodRecordRef lowerBound =
+		    (height == 1 && level->flushes == 0) ? dbBegin : entries.front().withoutValue();
+		state RedwoodRecordRef upperBound = lastBatch ? dbEnd : entries.back().withoutValue();
+
+		debug_printf("bulkBuild: writing %d records at height %d lastBatch=%d\n", count, height, lastBatch);
+		Standalone<VectorRef<RedwoodRecordRef>> links =
+		    wait(writePages(self,
+		                    &lowerBound,
+		                    &upperBound,
+		                    VectorRef<RedwoodRecordRef>(entries.begin(), count),
+		                    height,
+		                    v,
+		                    BTreeNodeLinkRef(),
+		                    invalidLogicalPageID));
+
+		for (auto& link : links) {
+			parent->pending.push_back_deep(parent->pending.arena(), link);
+			parent->pendingBytes += link.kvBytes();
+		}
+
+		level->pending = Standalone<VectorRef<RedwoodRecordRef>>();
+		level->pendingBytes = 0;
+		if (!lastBatch) {
+			level->pending.push_back_deep(level->pending.arena(), entries.back());
+			level->pendingBytes = entries.back().kvBytes();
+		}
+		++level->flushes;
+
+		return Void();
+	}
+
+	// Builds the tree from a stream of batches of sorted key/value pairs and commits it at version v.  Leaf pages
+	// are written fully packed as the input arrives and internal levels are built bottom-up from the leaf links,
+	// so pages are written once, directly to newly allocated page IDs, rather than being repeatedly rebuilt by the
+	// commit path.  This is only possible if the tree is empty and has no uncommitted mutations, otherwise nothing
+	// is read from input and false is returned.
+	ACTOR static Future<bool> bulkBuild_impl(VersionedBTree* self,
+	                                         FutureStream<Standalone<VectorRef<KeyValueRef>>> input,
+	                                         Version v) {
+		// Serialize with commits the same way commit_impl() does
+		state Promise<Void> committed;
+		Future<Void> previousCommit = self->m_latestCommit;
+		self->m_latestCommit = committed.getFuture();
+		wait(previousCommit);
+
+		ASSERT(v > self->m_pager->getLastCommittedVersion());
+
+		state bool empty = self->m_mutationCount == 0 && self->m_header.height == 1;
+		if (empty) {
+			state Reference<IPagerSnapshot> snapshot =
+			    self->m_pager->getReadSnapshot(self->m_pager->getLastCommittedVersion());
+			Reference<const ArenaPage> root = wait(readPage(self,
+			                                                PagerEventReasons::MetaData,
+			                                                1,
+			                                                snapshot.getPtr(),
+			                                                self->m_header.root,
+			                                                ioMaxPriority,
+			                                                false,
+			                                                true));
+			empty = ((const BTreePage*)root->data())->tree()->numItems == 0;
+		}
+
+		if (!empty) {
+			debug_printf("%s: bulkBuild not possible, tree is not empty\n", self->m_name.c_str());
+			committed.send(Void());
+			return false;
+		}
+
+		state std::vector<BulkBuildLevel> levels(1);
+		state int64_t batchBytes = SERVER_KNOBS->REDWOOD_BULK_BUILD_BATCH_BYTES;
+		state Standalone<VectorRef<KeyValueRef>> kvs;
+		state int i;
+		state int height;
+
+		try {
+			loop {
+				Standalone<VectorRef<KeyValueRef>> batch = waitNext(input);
+				kvs = batch;
+
+				for (i = 0; i < kvs.size(); ++i) {
+					{
+						const KeyValueRef& kv = kvs[i];
+						BulkBuildLevel& leaves = levels.front();
+						// Input must be strictly increasing across all batches
+						ASSERT(leaves.pending.empty() || leaves.pending.back().key < kv.key);
+						ASSERT(kv.key < dbEnd.key);
+
+						++g_redwoodMetrics.metric.opSet;
+						g_redwoodMetrics.metric.opSetKeyBytes += kv.key.size();
+						g_redwoodMetrics.metric.opSetValueBytes += kv.value.size();
+
+						leaves.pending.push_back_deep(leaves.pending.arena(), RedwoodRecordRef(kv.key, kv.value));
+						leaves.pendingBytes += leaves.pending.back().kvBytes();
+					}
+
+					// Write out each level, starting at the leaves, which has accumulated enough records
+					for (height = 1; height <= levels.size() && levels[height - 1].pendingBytes >= batchBytes &&
+					                 levels[height - 1].pending.size() > 1;
+					     ++height) {
+						wait(bulkBuildFlushLevel(self, &levels, height, v, false));
+					}
+				}
+			}
+		} catch (Error& e) {
+			if (e.code() != error_code_end_of_stream) {
+				throw;
+			}
+		}
+
+		if (levels.front().pending.empty()) {
+			// The tree stays empty, but v is still committed like any other bulk build
+			debug_printf("%s: bulkBuild input was empty\n", self->m_name.c_str());
+		} else {
+			// Write out the remainder of each level until a level produces exactly one link, which is the new root
+			height = 1;
+			loop {
+				wait(bulkBuildFlushLevel(self, &levels, height, v, true));
+				if (levels[height].flushes == 0 && levels[height].pending.size() == 1) {
+					break;
+				}
+				++height;
+			}
+
+			// Replace the empty root
+			self->freeBTreePage(1, self->m_header.root, v);
+			self->m_header.root = levels[height].pending.front().getChildPage();
+			self->m_header.height = height;
+			debug_printf("%s: bulkBuild new root %s height %d\n",
+			             self->m_name.c_str(),
+			             toString(self->m_header.root).c_str(),
+			             height);
+		}
+
+		self->m_pager->setOldestReadableVersion(self->m_newOldestVersion);
+
+		self->m_lazyClearStop = true;
+		wait(success(self->m_lazyClearActor));
+		wait(self->m_lazyClearQueue.flush());
+		self->m_header.lazyDeleteQueue = self->m_lazyClearQueue.getState();
+
+		wait(self->m_pager->commit(v, ObjectWriter::toValue(self->m_header, Unversioned())));
+		debug_printf("%s: bulkBuild committed version %" PRId64 "\n", self->m_name.c_str(), v);
+
+		++g_redwoodMetrics.metric.opCommit;
+		self->m_lazyClearActor = incrementalLazyClear(self);
+
+		committed.send(Void());
+		return true;
+	}
+
 	ACTOR static Future<Reference<const ArenaPage>> readPage(VersionedBTree* self,
 	                                                         PagerEventReasons reason,
 	                                                         unsigned int level,
@@ -6070,15 +6385,16 @@ private:
 		                                     ((BTreePage*)page->mutateData())->tree());
 	}
 
-	static void preLoadPage(IPagerSnapshot* snapshot, BTreeNodeLinkRef pageIDs, int priority) {
+	// Start loading a page into the cache.  The returned future can be dropped to stop waiting for the load.
+	static Future<Void> preLoadPage(IPagerSnapshot* snapshot, BTreeNodeLinkRef pageIDs, int priority) {
 		g_redwoodMetrics.metric.btreeLeafPreload += 1;
 		g_redwoodMetrics.metric.btreeLeafPreloadExt += (pageIDs.size() - 1);
 		if (pageIDs.size() == 1) {
-			snapshot->getPhysicalPage(
-			    PagerEventReasons::RangePrefetch, nonBtreeLevel, pageIDs.front(), priority, true, true);
+			return success(snapshot->getPhysicalPage(
+			    PagerEventReasons::RangePrefetch, nonBtreeLevel, pageIDs.front(), priority, true, true));
 		} else {
-			snapshot->getMultiPhysicalPage(
-			    PagerEventReasons::RangePrefetch, nonBtreeLevel, pageIDs, priority, true, true);
+			return success(snapshot->getMultiPhysicalPage(
+			    PagerEventReasons::RangePrefetch, nonBtreeLevel, pageIDs, priority, true, true));
 		}
 	}
 
@@ -6092,6 +6408,10 @@ private:
 		if (height > 1 && !btPageID.empty()) {
 			childUpdateTracker.erase(btPageID.front());
 		}
+
+		if (height == 1) {
+			invalidateLeafFilter(btPageID, v);
+		}
 	}
 
 	// Write new version of pageID at version v using page as its data.
@@ -6122,6 +6442,10 @@ private:
 		}
 
 		state unsigned int height = (unsigned int)((const BTreePage*)page->data())->height;
+		if (height == 1) {
+			self->invalidateLeafFilter(oldID, writeVersion);
+		}
+
 		if (oldID.size() == 1) {
 			page->setLogicalPageInfo(oldID.front(), parentID);
 			LogicalPageID id = wait(
@@ -7257,6 +7581,7 @@ private:
 		batch.readVersion = self->m_pager->getLastCommittedVersion();
 
 		self->m_pager->setOldestReadableVersion(self->m_newOldestVersion);
+		self->pruneLeafFilterInvalidations(self->m_pager->getOldestReadableVersion());
 		debug_printf("%s: Beginning commit of version %" PRId64 ", read version %" PRId64
 		             ", new oldest version set to %" PRId64 "\n",
 		             self->m_name.c_str(),
@@ -7344,12 +7669,22 @@ public:
 			const BTreePage* btPage() const { return (const BTreePage*)page->data(); };
 		};
 
+		// Progress of a range scan, shared between a cursor and its readahead actor
+		struct ReadAheadState : ReferenceCounted<ReadAheadState> {
+			int leavesReached = 0; // Leaves the scan has moved to after its first leaf
+			int leavesIssued = 0; // Leaves the readahead actor has started loading
+			AsyncTrigger progress;
+		};
+
 	private:
 		PagerEventReasons reason;
 		VersionedBTree* btree;
 		Reference<IPagerSnapshot> pager;
 		bool valid;
 		std::vector<PathEntry> path;
+		Reference<ReadAheadState> readAheadState;
+		Future<Void> readAheadActor;
+		std::vector<Future<Void>> siblingPreloads;
 
 	public:
 		BTreeCursor() : reason(PagerEventReasons::MAXEVENTREASONS) {}
@@ -7450,6 +7785,7 @@ public:
 			btree = btree_in;
 			reason = reason_in;
 			pager = pager_in;
+			stopReadAhead();
 			path.clear();
 			path.reserve(6);
 			valid = false;
@@ -7513,6 +7849,55 @@ public:
 
 		Future<Void> seekGTE(RedwoodRecordRef query) { return seekGTE_impl(this, query); }
 
+		// Seeks cursor to the record with the same key as query and returns whether it exists.  If it does not exist
+		// the cursor is invalid and its position is undefined.  Leaf filters are consulted before reading leaf pages
+		// so definite misses are answered from the level above the leaves.
+		ACTOR Future<bool> seekEQ_impl(BTreeCursor* self, RedwoodRecordRef query) {
+			state RedwoodRecordRef internalPageQuery = query.withMaxPageID();
+			state LogicalPageID leaf = invalidLogicalPageID;
+			state bool filtered = false;
+			self->path.resize(1);
+			debug_printf("seekEQ(%s) start cursor = %s\n", query.toString().c_str(), self->toString().c_str());
+
+			loop {
+				auto& entry = self->path.back();
+				if (entry.btPage()->isLeaf()) {
+					self->valid = entry.cursor.seekGreaterThanOrEqual(query) && entry.cursor.get().key == query.key;
+					if (leaf != invalidLogicalPageID) {
+						if (filtered) {
+							if (!self->valid) {
+								++g_redwoodMetrics.metric.btreeFilterFalsePositive;
+							}
+						} else {
+							self->btree->buildLeafFilter(leaf, self->pager->getVersion(), entry.cursor);
+						}
+					}
+					return self->valid;
+				}
+
+				if (!entry.cursor.seekLessThan(internalPageQuery) || !entry.cursor.get().value.present()) {
+					self->valid = false;
+					return false;
+				}
+
+				if (entry.btPage()->height == 2 && SERVER_KNOBS->REDWOOD_POINT_READ_FILTER_BYTES > 0) {
+					leaf = entry.cursor.get().getChildPage().front();
+					LeafFilterResult r = self->btree->checkLeafFilter(leaf, self->pager->getVersion(), query.key);
+					if (r == LeafFilterResult::Negative) {
+						debug_printf("seekEQ(%s) leaf filter miss\n", query.toString().c_str());
+						self->valid = false;
+						return false;
+					}
+					filtered = r == LeafFilterResult::Positive;
+				}
+
+				Future<Void> f = self->pushPage(entry.cursor);
+				wait(f);
+			}
+		}
+
+		Future<bool> seekEQ(RedwoodRecordRef query) { return path.empty() ? false : seekEQ_impl(this, query); }
+
 		// Start fetching sibling nodes in the forward or backward direction, stopping after recordLimit or byteLimit
 		void prefetch(KeyRef rangeEnd, bool directionForward, int recordLimit, int byteLimit) {
 			// Prefetch scans level 2 so if there are less than 2 nodes in the path there is no level 2
@@ -7561,7 +7946,7 @@ public:
 				if (c.get().value.present()) {
 					BTreeNodeLinkRef childPage = c.get().getChildPage();
 					if (childPage.size() > 0)
-						preLoadPage(pager.getPtr(), childPage, ioLeafPriority);
+						siblingPreloads.push_back(preLoadPage(pager.getPtr(), childPage, ioLeafPriority));
 					recordsRead += estRecordsPerPage;
 					// Use sibling node capacity as an estimate of bytes read.
 					bytesRead += childPage.size() * this->btree->m_blockSize;
@@ -7569,6 +7954,144 @@ public:
 			}
 		}
 
+		// Loads leaves ahead of a range scan, in scan order and across parent boundaries, keeping up to a window of
+		// leaves ahead of the scan which grows as the scan progresses.  path is a copy of the scanning cursor's
+		// internal path entries.  Leaves are loaded until boundary is passed, maxLeaves have been loaded, or the
+		// actor is cancelled, which happens when the scanning cursor stops, is destroyed or is reinitialized.  Leaf
+		// loads still in progress are cancelled along with the actor.
+		ACTOR static Future<Void> readAhead_impl(VersionedBTree* btree,
+		                                         Reference<IPagerSnapshot> pager,
+		                                         std::vector<PathEntry> path,
+		                                         Reference<ReadAheadState> ras,
+		                                         Key boundary,
+		                                         bool forward,
+		                                         int64_t maxLeaves) {
+			state Key lastLinkKey;
+			state Reference<const ArenaPage> childPage;
+			state std::deque<Future<Void>> preloads;
+
+			loop {
+				// Wait for the scan to get close enough to the last leaf loaded
+				loop {
+					int window = std::min<int64_t>(SERVER_KNOBS->REDWOOD_READAHEAD_MAX_LEAVES,
+					                               (ras->leavesReached + 1) * 2);
+					if (ras->leavesIssued >= maxLeaves) {
+						return Void();
+					}
+					if (ras->leavesIssued < ras->leavesReached + window) {
+						break;
+					}
+					wait(ras->progress.onTrigger());
+				}
+
+				// Move to the next link at the lowest internal level, going up as far as needed
+				lastLinkKey = path.back().cursor.get().key;
+				loop {
+					bool success;
+					{
+						auto& entry = path.back();
+						success = forward ? entry.cursor.moveNext() : entry.cursor.movePrev();
+						// Skip over internal page entries that do not link to child pages
+						if (success && !entry.cursor.get().value.present()) {
+							success = forward ? entry.cursor.moveNext() : entry.cursor.movePrev();
+						}
+					}
+					if (success) {
+						break;
+					}
+					if (path.size() == 1) {
+						return Void();
+					}
+					path.pop_back();
+				}
+
+				// Go back down to the lowest internal level, reading internal pages as needed
+				while (path.back().btPage()->height > 2) {
+					if (!forward && !path.back().cursor.get().value.present()) {
+						UNSTOPPABLE_ASSERT(path.back().cursor.movePrev());
+					}
+					Reference<const ArenaPage> p = wait(readPage(btree,
+					                                             PagerEventReasons::RangePrefetch,
+					                                             path.back().btPage()->height - 1,
+					                                             pager.getPtr(),
+					                                             path.back().cursor.get().getChildPage(),
+					                                             ioLeafPriority,
+					                                             false,
+					                                             true));
+					childPage = p;
+					PathEntry child;
+					child.page = childPage;
+					child.cursor = btree->getCursor(childPage.getPtr(), path.back().cursor);
+					UNSTOPPABLE_ASSERT(forward ? child.cursor.moveFirst() : child.cursor.moveLast());
+					path.push_back(child);
+				}
+
+				{
+					auto& entry = path.back();
+					if (!forward && !entry.cursor.get().value.present()) {
+						if (!entry.cursor.movePrev()) {
+							return Void();
+						}
+					}
+
+					// Stop once the next leaf is entirely outside of the range being scanned
+					if (forward ? entry.cursor.get().key >= boundary : lastLinkKey <= boundary) {
+						return Void();
+					}
+
+					while (!preloads.empty() && preloads.front().isReady()) {
+						preloads.pop_front();
+					}
+					preloads.push_back(preLoadPage(pager.getPtr(), entry.cursor.get().getChildPage(), ioLeafPriority));
+					++ras->leavesIssued;
+				}
+			}
+		}
+
+		// Start loading leaves ahead of a range scan in the given direction which will not go beyond boundary or
+		// exceed the row or byte limit.  The scan must call readAheadAdvance() each time it moves to another leaf.
+		void startReadAhead(KeyRef boundary, bool directionForward, int rowLimit, int byteLimit) {
+			// Read ahead works from level 2 so if there are less than 2 nodes in the path there is no level 2
+			if (path.size() < 2) {
+				return;
+			}
+
+			// Estimate the number of leaves needed to satisfy the limits from the first leaf
+			auto firstLeaf = path.back().btPage();
+			int64_t records = std::max<int64_t>(1, firstLeaf->tree()->numItems);
+			int64_t leavesForRows = (rowLimit - records + records - 1) / records;
+			int64_t leavesForBytes =
+			    (byteLimit - (int64_t)firstLeaf->kvBytes + btree->m_blockSize - 1) / btree->m_blockSize;
+			int64_t maxLeaves = std::min(leavesForRows, leavesForBytes);
+			if (maxLeaves <= 0) {
+				return;
+			}
+
+			readAheadState = makeReference<ReadAheadState>();
+			readAheadActor = readAhead_impl(btree,
+			                                pager,
+			                                std::vector<PathEntry>(path.begin(), path.end() - 1),
+			                                readAheadState,
+			                                boundary,
+			                                directionForward,
+			                                maxLeaves);
+		}
+
+		// Cancel read ahead and prefetch, if any, and the page loads they have started
+		void stopReadAhead() {
+			readAheadState.clear();
+			readAheadActor = Void();
+			siblingPreloads.clear();
+		}
+
+		// Notify read ahead, if any, that the scan has moved to another leaf
+		void readAheadAdvance() {
+			if (readAheadState.isValid()) {
+				++readAheadState->leavesReached;
+				readAheadState->progress.trigger();
+			}
+		}
+
 		ACTOR Future<Void> seekLT_impl(BTreeCursor* self, RedwoodRecordRef query) {
 			debug_printf("seekLT(%s) start\n", query.toString().c_str());
 			int cmp = wait(self->seek(query));
@@ -7773,6 +8296,52 @@ public:
 		return m_lastCommit;
 	}
 
+	Future<Void> bulkLoad(FutureStream<Standalone<VectorRef<KeyValueRef>>> data) override {
+		return catchError(bulkLoad_impl(this, data));
+	}
+
+	bool supportsBulkLoad() const override { return true; }
+
+	// If the tree is empty, build it directly from the sorted input and commit it.  Otherwise, such as when a storage
+	// server ingests a shard, apply the input as sets, which the caller's next commit() makes durable along with its
+	// other writes.
+	ACTOR static Future<Void> bulkLoad_impl(KeyValueStoreRedwood* self,
+	                                        FutureStream<Standalone<VectorRef<KeyValueRef>>> data) {
+		// bulkBuild() checks again once the commits in progress are done, but a tree already known not to be empty
+		// does not have to wait for them.
+		if (self->m_tree->mayBulkBuild()) {
+			state Version v = self->m_nextCommitVersion;
+			self->m_tree->setOldestReadableVersion(v);
+			++self->m_nextCommitVersion;
+
+			state Future<bool> built = self->m_tree->bulkBuild(data, v);
+			// Commits after this one wait for it, so it must finish even if the caller stops waiting
+			self->m_bulkBuilds = self->m_bulkBuilds && success(built);
+			self->m_lastCommit = success(built);
+			bool b = wait(built);
+			if (b) {
+				TEST(true); // Redwood bulk build
+				return Void();
+			}
+		}
+
+		TEST(true); // Redwood bulk load into non-empty tree
+		try {
+			loop {
+				Standalone<VectorRef<KeyValueRef>> kvs = waitNext(data);
+				for (auto& kv : kvs) {
+					self->m_tree->set(kv);
+				}
+			}
+		} catch (Error& e) {
+			if (e.code() != error_code_end_of_stream) {
+				throw;
+			}
+		}
+
+		return Void();
+	}
+
 	KeyValueStoreType getType() const override { return KeyValueStoreType::SSD_REDWOOD_V1; }
 
 	StorageBytes getStorageBytes() const override { return m_tree->getStorageBytes(); }
@@ -7825,7 +8394,11 @@ public:
 			}
 
 			if (self->prefetch) {
-				cur.prefetch(keys.end, true, rowLimit, byteLimit);
+				if (SERVER_KNOBS->REDWOOD_READAHEAD_MAX_LEAVES > 0) {
+					cur.startReadAhead(keys.end, true, rowLimit, byteLimit);
+				} else {
+					cur.prefetch(keys.end, true, rowLimit, byteLimit);
+				}
 			}
 
 			while (cur.isValid()) {
@@ -7868,6 +8441,7 @@ public:
 				}
 				cur.popPath();
 				wait(cur.moveNext());
+				cur.readAheadAdvance();
 			}
 		} else {
 			f = cur.seekLT(keys.end);
@@ -7881,7 +8455,11 @@ public:
 			}
 
 			if (self->prefetch) {
-				cur.prefetch(keys.begin, false, -rowLimit, byteLimit);
+				if (SERVER_KNOBS->REDWOOD_READAHEAD_MAX_LEAVES > 0) {
+					cur.startReadAhead(keys.begin, false, -rowLimit, byteLimit);
+				} else {
+					cur.prefetch(keys.begin, false, -rowLimit, byteLimit);
+				}
 			}
 
 			while (cur.isValid()) {
@@ -7924,9 +8502,13 @@ public:
 				}
 				cur.popPath();
 				wait(cur.movePrev());
+				cur.readAheadAdvance();
 			}
 		}
 
+		// The scan is done, so stop loading leaves ahead of it
+		cur.stopReadAhead();
+
 		result.more = rowLimit == 0 || accumulatedBytes >= byteLimit;
 		if (result.more) {
 			ASSERT(result.size() > 0);
@@ -7945,8 +8527,8 @@ public:
 		// state PriorityMultiLock::Lock lock = wait(self->m_concurrentReads.lock());
 
 		++g_redwoodMetrics.metric.opGet;
-		wait(cur.seekGTE(key));
-		if (cur.isValid() && cur.get().key == key) {
+		bool found = wait(cur.seekEQ(key));
+		if (found) {
 			// Return a Value whose arena depends on the source page arena
 			Value v;
 			v.arena().dependsOn(cur.back().page->getArena());
@@ -7987,6 +8569,7 @@ private:
 	Version m_nextCommitVersion;
 	std::shared_ptr<IEncryptionKeyProvider> m_keyProvider;
 	Future<Void> m_lastCommit = Void();
+	Future<Void> m_bulkBuilds = Void();
 
 	template <typename T>
 	inline Future<T> catchError(Future<T> f) {
@@ -8238,8 +8821,15 @@ ACTOR Future<Void> seekAllBTreeCursor(VersionedBTree* btree,
 			state Optional<std::string> val = i->second;
 			debug_printf("Verifying @%" PRId64 " '%s'\n", ver, key.c_str());
 			state Arena arena;
-			wait(cur.seekGTE(RedwoodRecordRef(KeyRef(arena, key))));
-			bool foundKey = cur.isValid() && cur.get().key == key;
+			state bool foundKey;
+			// Sometimes use the point read seek, which can be answered by leaf filters
+			if (deterministicRandom()->coinflip()) {
+				bool found = wait(cur.seekEQ(RedwoodRecordRef(KeyRef(arena, key))));
+				foundKey = found;
+			} else {
+				wait(cur.seekGTE(RedwoodRecordRef(KeyRef(arena, key))));
+				foundKey = cur.isValid() && cur.get().key == key;
+			}
 			bool hasValue = foundKey && cur.get().value.present();
 
 			if (val.present()) {
@@ -8493,6 +9083,11 @@ void RedwoodMetrics::getFields(TraceEvent* e, std::string* s, bool skipZeroes) {
 	std::pair<const char*, unsigned int> metrics[] = { { "BTreePreload", metric.btreeLeafPreload },
 		                                               { "BTreePreloadExt", metric.btreeLeafPreloadExt },
 		                                               { "", 0 },
+		                                               { "BTreeFilterNeg", metric.btreeFilterNegative },
+		                                               { "BTreeFilterPos", metric.btreeFilterPositive },
+		                                               { "BTreeFilterFP", metric.btreeFilterFalsePositive },
+		                                               { "BTreeFilterBuild", metric.btreeFilterBuild },
+		                                               { "", 0 },
 		                                               { "OpSet", metric.opSet },
 		                                               { "OpSetKeyBytes", metric.opSetKeyBytes },
 		                                               { "OpSetValueBytes", metric.opSetValueBytes },
@@ -10133,6 +10728,191 @@ TEST_CASE("Lredwood/correctness/btree") {
 	return Void();
 }
 
+TEST_CASE("/redwood/correctness/btree/bulkBuild") {
+	g_redwoodMetricsActor = Void(); // Prevent trace event metrics from starting
+	g_redwoodMetrics.clear();
+
+	state std::string file = params.get("file").orDefault("unittest_bulkBuild.redwood-v1");
+	state int pageSize = params.getInt("pageSize").orDefault(
+	    deterministicRandom()->coinflip() ? 4096 : deterministicRandom()->randomInt(200, 400));
+	state int extentSize = SERVER_KNOBS->REDWOOD_DEFAULT_EXTENT_SIZE;
+	state int64_t pageCacheBytes = params.getInt("pageCacheBytes").orDefault(pageSize * 1000);
+	state int recordCount = params.getInt("recordCount").orDefault(deterministicRandom()->randomInt(0, 20000));
+	state int maxKeySize = params.getInt("maxKeySize").orDefault(deterministicRandom()->randomInt(1, pageSize * 2));
+	state int maxValueSize = params.getInt("maxValueSize").orDefault(randomSize(pageSize * 4));
+	state int batchSize = params.getInt("batchSize").orDefault(deterministicRandom()->randomInt(1, 1000));
+
+	printf("\n");
+	printf("file: %s\n", file.c_str());
+	printf("pageSize: %d\n", pageSize);
+	printf("recordCount: %d\n", recordCount);
+	printf("maxKeySize: %d\n", maxKeySize);
+	printf("maxValueSize: %d\n", maxValueSize);
+	printf("batchSize: %d\n", batchSize);
+
+	deleteFile(file);
+	state VersionedBTree* btree =
+	    new VersionedBTree(new DWALPager(pageSize,
+	                                     extentSize,
+	                                     file,
+	                                     pageCacheBytes,
+	                                     0,
+	                                     SERVER_KNOBS->REDWOOD_EXTENT_CONCURRENT_READS,
+	                                     false,
+	                                     nullptr),
+	                       file,
+	                       EncodingType::XXHash64,
+	                       nullptr);
+	wait(btree->init());
+
+	// Generate sorted unique records
+	state std::map<std::string, std::string> records;
+	while (records.size() < recordCount) {
+		KeyValue kv = randomKV(maxKeySize, maxValueSize);
+		records[kv.key.toString()] = kv.value.toString();
+	}
+
+	state Version v = btree->getLastCommittedVersion() + 1;
+	state PromiseStream<Standalone<VectorRef<KeyValueRef>>> input;
+	state Future<bool> built = btree->bulkBuild(input.getFuture(), v);
+
+	state std::map<std::pair<std::string, Version>, Optional<std::string>> written;
+	state std::map<std::string, std::string>::const_iterator i = records.cbegin();
+	while (i != records.cend()) {
+		Standalone<VectorRef<KeyValueRef>> batch;
+		while (i != records.cend() && batch.size() < batchSize) {
+			batch.push_back_deep(batch.arena(), KeyValueRef(i->first, i->second));
+			written[std::make_pair(i->first, v)] = i->second;
+			++i;
+		}
+		input.send(batch);
+		wait(yield());
+	}
+	input.sendError(end_of_stream());
+
+	bool b = wait(built);
+	ASSERT(b);
+	ASSERT(btree->getLastCommittedVersion() == v);
+
+	state int64_t recordsRead = 0;
+	wait(seekAllBTreeCursor(btree, v, &written, &recordsRead));
+	wait(verifyRangeBTreeCursor(btree, LiteralStringRef(""), LiteralStringRef("\xff\xff"), v, &written, &recordsRead));
+
+	// A second bulk build must be refused because the tree is no longer empty
+	if (recordCount > 0) {
+		state PromiseStream<Standalone<VectorRef<KeyValueRef>>> input2;
+		input2.sendError(end_of_stream());
+		bool b2 = wait(btree->bulkBuild(input2.getFuture(), v + 1));
+		ASSERT(!b2);
+	}
+
+	// Reopen and verify again
+	state Future<Void> closedFuture = btree->onClosed();
+	btree->close();
+	wait(closedFuture);
+	btree = new VersionedBTree(new DWALPager(pageSize,
+	                                         extentSize,
+	                                         file,
+	                                         pageCacheBytes,
+	                                         0,
+	                                         SERVER_KNOBS->REDWOOD_EXTENT_CONCURRENT_READS,
+	                                         false,
+	                                         nullptr),
+	                           file,
+	                           EncodingType::XXHash64,
+	                           nullptr);
+	wait(btree->init());
+	ASSERT(btree->getLastCommittedVersion() == v);
+	wait(seekAllBTreeCursor(btree, v, &written, &recordsRead));
+
+	wait(btree->clearAllAndCheckSanity());
+
+	closedFuture = btree->onClosed();
+	btree->close();
+	wait(closedFuture);
+
+	return Void();
+}
+
+ACTOR Future<Void> bulkLoadKVS(IKeyValueStore* kvs, std::map<std::string, std::string> const* records, int batchSize) {
+	state PromiseStream<Standalone<VectorRef<KeyValueRef>>> input;
+	state Future<Void> loaded = kvs->bulkLoad(input.getFuture());
+	state std::map<std::string, std::string>::const_iterator i = records->cbegin();
+	while (i != records->cend()) {
+		Standalone<VectorRef<KeyValueRef>> batch;
+		while (i != records->cend() && batch.size() < batchSize) {
+			batch.push_back_deep(batch.arena(), KeyValueRef(i->first, i->second));
+			++i;
+		}
+		input.send(batch);
+		wait(yield());
+	}
+	input.sendError(end_of_stream());
+	wait(loaded);
+	return Void();
+}
+
+// Checks that the committed contents of kvs are exactly expected
+ACTOR Future<Void> verifyKVS(IKeyValueStore* kvs, std::map<std::string, std::string> const* expected) {
+	RangeResult result = wait(kvs->readRange(KeyRangeRef(""_sr, "\xff\xff"_sr)));
+	ASSERT(!result.more);
+	ASSERT(result.size() == expected->size());
+	auto i = expected->cbegin();
+	for (auto& kv : result) {
+		ASSERT(kv.key == StringRef(i->first) && kv.value == StringRef(i->second));
+		++i;
+	}
+	return Void();
+}
+
+TEST_CASE("/redwood/correctness/kvs/bulkLoad") {
+	state std::string file = params.get("file").orDefault("unittest_bulkLoad.redwood-v1");
+	state int recordCount = params.getInt("recordCount").orDefault(deterministicRandom()->randomInt(1, 5000));
+	state int batchSize = params.getInt("batchSize").orDefault(deterministicRandom()->randomInt(1, 1000));
+
+	deleteFile(file);
+	state IKeyValueStore* kvs = keyValueStoreRedwoodV1(file, UID());
+	wait(kvs->init());
+	ASSERT(kvs->supportsBulkLoad());
+
+	// Into an empty store the records are built directly and committed
+	state std::map<std::string, std::string> records;
+	while (records.size() < recordCount) {
+		KeyValue kv = randomKV(50, 500);
+		records[kv.key.toString()] = kv.value.toString();
+	}
+	wait(bulkLoadKVS(kvs, &records, batchSize));
+	wait(verifyKVS(kvs, &records));
+
+	// Into a store with data the records are only set, some of them overwriting existing ones, until the next commit
+	state std::map<std::string, std::string> more;
+	while (more.size() < recordCount) {
+		KeyValue kv = randomKV(50, 500);
+		more[kv.key.toString()] = kv.value.toString();
+	}
+	wait(bulkLoadKVS(kvs, &more, batchSize));
+	wait(verifyKVS(kvs, &records));
+	wait(kvs->commit());
+	for (auto& kv : more) {
+		records[kv.first] = kv.second;
+	}
+	wait(verifyKVS(kvs, &records));
+
+	// Both are durable
+	state Future<Void> closed = kvs->onClosed();
+	kvs->close();
+	wait(closed);
+	kvs = keyValueStoreRedwoodV1(file, UID());
+	wait(kvs->init());
+	wait(verifyKVS(kvs, &records));
+
+	closed = kvs->onClosed();
+	kvs->dispose();
+	wait(closed);
+
+	return Void();
+}
+
 ACTOR Future<Void> randomSeeks(VersionedBTree* btree,
                                Optional<Version> v,
                                bool reInitCursor,
@@ -1822,6 +1822,15 @@ int main(int argc, char* argv[]) {
 		// Reinitialize knobs in order to update knobs that are dependent on explicitly set knobs
 		g_knobs.initialize(Randomize::True, role == ServerRole::Simulation ? IsSimulated::True : IsSimulated::False);
 
+		// Busy polling burns a core per process, so it can be limited to the latency critical process classes
+		if (FLOW_KNOBS->NETWORK_BUSY_POLL_TIME > 0 && !FLOW_KNOBS->NETWORK_BUSY_POLL_PROCESS_CLASSES.empty()) {
+			std::vector<std::string> classes;
+			boost::split(classes, FLOW_KNOBS->NETWORK_BUSY_POLL_PROCESS_CLASSES, [](char c) { return c == ','; });
+			if (std::find(classes.begin(), classes.end(), opts.processClass.toString()) == classes.end()) {
+				g_knobs.setKnob("network_busy_poll_time", KnobValue::create(0.0));
+			}
+		}
+
 		// evictionPolicyStringToEnum will throw an exception if the string is not recognized as a valid
 		EvictablePageCache::evictionPolicyStringToEnum(FLOW_KNOBS->CACHE_EVICTION_POLICY);
 
@@ -259,6 +259,7 @@ struct StorageServerDisk {
 
 	void writeMutation(MutationRef mutation);
 	void writeKeyValue(KeyValueRef kv);
+	Future<Void> writeKeyValues(RangeResult const& kvs);
 	void clearRange(KeyRangeRef keys);
 
 	Future<Void> getError() { return storage->getError(); }
@@ -305,6 +306,7 @@ struct StorageServerDisk {
 		return storage->deleteCheckpoint(checkpoint);
 	}
 
+	bool supportsBulkLoad() const { return storage->supportsBulkLoad(); }
 	KeyValueStoreType getKeyValueStoreType() const { return storage->getType(); }
 	StorageBytes getStorageBytes() const { return storage->getStorageBytes(); }
 	std::tuple<size_t, size_t, size_t> getSize() const { return storage->getSize(); }
@@ -937,6 +939,8 @@ public:
 		Counter kvScans;
 		// The count of commit operation to the storage engine.
 		Counter kvCommits;
+		// Bytes of the rows that filtered range reads read but did not return, counted like bytesQueried.
+		Counter filteredBytes;
 
 		LatencySample readLatencySample;
 		LatencyBands readLatencyBands;
@@ -967,6 +971,7 @@ public:
 		    quickGetKeyValuesHit("QuickGetKeyValuesHit", cc), quickGetKeyValuesMiss("QuickGetKeyValuesMiss", cc),
 		    kvScanBytes("KVScanBytes", cc), kvGetBytes("KVGetBytes", cc), eagerReadsKeys("EagerReadsKeys", cc),
 		    kvGets("KVGets", cc), kvScans("KVScans", cc), kvCommits("KVCommits", cc),
+		    filteredBytes("FilteredBytes", cc),
 		    readLatencySample("ReadLatencyMetrics",
 		                      self->thisServerID,
 		                      SERVER_KNOBS->LATENCY_METRICS_LOGGING_INTERVAL,
@@ -3083,6 +3088,72 @@ ACTOR Future<GetKeyValuesReply> readRange(StorageServer* data,
 	return result;
 }
 
+// Reads the rows of range that match filter, up to the limits of the request. readRange is called on successive parts
+// of range, RANGE_READ_FILTER_BATCH_ROWS rows at a time, until enough rows have matched or the range is exhausted.
+// A sparse filter could otherwise turn one request into a scan of the whole shard, so the reply is also sent once
+// RANGE_READ_FILTER_SCAN_BYTES have been read, with lastScannedKey telling the client where to continue.
+ACTOR Future<GetKeyValuesReply> readRangeFiltered(StorageServer* data,
+                                                  Version version,
+                                                  KeyRange range,
+                                                  int limit,
+                                                  int* pLimitBytes,
+                                                  SpanID parentSpan,
+                                                  IKeyValueStore::ReadType type,
+                                                  Optional<Key> tenantPrefix,
+                                                  RangeReadFilterRef filter) {
+	state GetKeyValuesReply result;
+	state int sign = limit >= 0 ? 1 : -1;
+	state int64_t scannedBytes = 0;
+	ASSERT(limit != 0 && *pLimitBytes > 0);
+
+	loop {
+		state int scanLimitBytes = SERVER_KNOBS->RANGE_READ_FILTER_SCAN_BYTES - scannedBytes;
+		GetKeyValuesReply batch = wait(readRange(data,
+		                                         version,
+		                                         range,
+		                                         sign * SERVER_KNOBS->RANGE_READ_FILTER_BATCH_ROWS,
+		                                         &scanLimitBytes,
+		                                         parentSpan,
+		                                         type,
+		                                         tenantPrefix));
+		result.arena.dependsOn(batch.arena);
+		result.cached = batch.cached;
+
+		int i = 0;
+		for (; i < batch.data.size() && limit != 0 && *pLimitBytes > 0; i++) {
+			const KeyValueRef& kv = batch.data[i];
+			int size = sizeof(KeyValueRef) + kv.expectedSize();
+			scannedBytes += size;
+			if (filter.matches(kv.key, kv.value)) {
+				result.data.push_back(result.arena, kv);
+				limit -= sign;
+				*pLimitBytes -= size;
+			} else {
+				result.filteredBytes += size;
+			}
+		}
+
+		if (i == batch.data.size() && !batch.more) {
+			result.more = false;
+			break;
+		}
+		// i > 0 here, because readRange only reports more after reading at least one row
+		KeyRef lastScanned = batch.data[i - 1].key;
+		if (i < batch.data.size() || limit == 0 || *pLimitBytes <= 0 ||
+		    scannedBytes >= SERVER_KNOBS->RANGE_READ_FILTER_SCAN_BYTES) {
+			result.more = true;
+			result.lastScannedKey = lastScanned;
+			break;
+		}
+
+		KeyRef next = addPrefix(lastScanned, tenantPrefix, result.arena);
+		range = sign > 0 ? KeyRangeRef(keyAfter(next, result.arena), range.end) : KeyRangeRef(range.begin, next);
+	}
+
+	result.version = version;
+	return result;
+}
+
 KeyRangeRef StorageServer::clampRangeToTenant(KeyRangeRef range, Optional<TenantMapEntry> tenantEntry, Arena& arena) {
 	if (tenantEntry.present()) {
 		return KeyRangeRef(range.begin.startsWith(tenantEntry.get().prefix) ? range.begin : tenantEntry.get().prefix,
@@ -3325,14 +3396,23 @@ ACTOR Future<Void> getKeyValuesQ(StorageServer* data, GetKeyValuesRequest req)
 		} else {
 			state int remainingLimitBytes = req.limitBytes;
 
-			GetKeyValuesReply _r = wait(readRange(data,
-			                                      version,
-			                                      KeyRangeRef(begin, end),
-			                                      req.limit,
-			                                      &remainingLimitBytes,
-			                                      span.context,
-			                                      type,
-			                                      tenantPrefix));
+			GetKeyValuesReply _r = wait(req.filter.present() ? readRangeFiltered(data,
+			                                                                     version,
+			                                                                     KeyRangeRef(begin, end),
+			                                                                     req.limit,
+			                                                                     &remainingLimitBytes,
+			                                                                     span.context,
+			                                                                     type,
+			                                                                     tenantPrefix,
+			                                                                     req.filter.get())
+			                                                 : readRange(data,
+			                                                             version,
+			                                                             KeyRangeRef(begin, end),
+			                                                             req.limit,
+			                                                             &remainingLimitBytes,
+			                                                             span.context,
+			                                                             type,
+			                                                             tenantPrefix));
 			GetKeyValuesReply r = _r;
 
 			if (req.debugID.present())
@@ -3374,6 +3454,7 @@ ACTOR Future<Void> getKeyValuesQ(StorageServer* data, GetKeyValuesRequest req)
 			resultSize = req.limitBytes - remainingLimitBytes;
 			data->counters.bytesQueried += resultSize;
 			data->counters.rowsQueried += r.data.size();
+			data->counters.filteredBytes += r.filteredBytes;
 			if (r.data.size() == 0) {
 				++data->counters.emptyQueries;
 			}
@@ -5667,9 +5748,13 @@ ACTOR Future<Void> fetchKeys(StorageServer* data, AddingShard* shard) {
 
 					// Write this_block to storage
 					state KeyValueRef* kvItr = this_block.begin();
-					for (; kvItr != this_block.end(); ++kvItr) {
-						data->storage.writeKeyValue(*kvItr);
-						wait(yield());
+					if (data->storage.supportsBulkLoad()) {
+						wait(data->storage.writeKeyValues(this_block));
+					} else {
+						for (; kvItr != this_block.end(); ++kvItr) {
+							data->storage.writeKeyValue(*kvItr);
+							wait(yield());
+						}
 					}
 
 					kvItr = this_block.begin();
@@ -7562,6 +7647,18 @@ void StorageServerDisk::writeKeyValue(KeyValueRef kv) {
 	*kvCommitLogicalBytes += kv.expectedSize();
 }
 
+// Writes sorted rows through IKeyValueStore::bulkLoad(), which builds the store directly from them if it is empty.
+// Otherwise they are sets like those of writeKeyValue(), made durable by the next commit().
+Future<Void> StorageServerDisk::writeKeyValues(RangeResult const& kvs) {
+	for (auto& kv : kvs) {
+		*kvCommitLogicalBytes += kv.expectedSize();
+	}
+	PromiseStream<Standalone<VectorRef<KeyValueRef>>> input;
+	input.send(Standalone<VectorRef<KeyValueRef>>(kvs, kvs.arena()));
+	input.sendError(end_of_stream());
+	return storage->bulkLoad(input.getFuture());
+}
+
 void StorageServerDisk::writeMutation(MutationRef mutation) {
 	if (mutation.type == MutationRef::SetValue) {
 		storage->set(KeyValueRef(mutation.param1, mutation.param2));
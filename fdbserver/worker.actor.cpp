@@ -1109,6 +1109,20 @@ void updateCpuProfiler(ProfilerRequest req) {
 			break;
 		}
 		break;
+	case ProfilerRequest::Type::ALLOCATION:
+		switch (req.action) {
+		case ProfilerRequest::Action::ENABLE:
+			setAllocationSampling(FLOW_KNOBS->ALLOCATION_SAMPLING_BYTES);
+			break;
+		case ProfilerRequest::Action::DISABLE:
+			logAllocationSamples(FLOW_KNOBS->ALLOCATION_SAMPLES_LOGGED);
+			setAllocationSampling(0);
+			break;
+		case ProfilerRequest::Action::RUN:
+			ASSERT(false); // User should have called runProfiler.
+			break;
+		}
+		break;
 	default:
 		ASSERT(false);
 		break;
@@ -2843,6 +2857,14 @@ ACTOR Future<Void> serveProcess() {
 				ActorLineageReply reply{ serializedSamples };
 				req.reply.send(reply);
 			}
+			when(AllocationSamplesRequest req = waitNext(process.allocationSamples.getFuture())) {
+				AllocationSamplesReply reply;
+				for (auto& site : getAllocationSamples(req.topN)) {
+					reply.sites.push_back(AllocationSample{
+					    site.source, site.exampleSize, site.samples, site.estimatedBytes, site.backtrace });
+				}
+				req.reply.send(reply);
+			}
 		}
 	}
 }
@@ -33,6 +33,7 @@ struct AtomicOpsWorkload : TestWorkload {
 	int opNum, actorCount, nodeCount;
 	uint32_t opType;
 	bool apiVersion500 = false;
+	bool coalesceCommits;
 
 	double testDuration, transactionsPerSecond;
 	std::vector<Future<Void>> clients;
@@ -44,6 +45,7 @@ struct AtomicOpsWorkload : TestWorkload {
 		actorCount = getOption(options, LiteralStringRef("actorsPerClient"), transactionsPerSecond / 5);
 		opType = getOption(options, LiteralStringRef("opType"), -1);
 		nodeCount = getOption(options, LiteralStringRef("nodeCount"), 1000);
+		coalesceCommits = getOption(options, "coalesceCommits"_sr, deterministicRandom()->coinflip());
 		// Atomic OPs Min and And have modified behavior from api version 510. Hence allowing testing for older version
 		// (500) with a 10% probability Actual change of api Version happens in setup
 		apiVersion500 = ((sharedRandomNumber % 10) == 0);
@@ -104,7 +106,7 @@ struct AtomicOpsWorkload : TestWorkload {
 		default:
 			ASSERT(false);
 		}
-		TraceEvent("AtomicWorkload").detail("OpType", opType);
+		TraceEvent("AtomicWorkload").detail("OpType", opType).detail("CoalesceCommits", coalesceCommits);
 	}
 
 	std::string description() const override { return "AtomicOps"; }
@@ -119,9 +121,20 @@ struct AtomicOpsWorkload : TestWorkload {
 	}
 
 	Future<Void> start(Database const& cx) override {
+		// The commits of all workers go through one database so that they can be coalesced
+		Database coalescingDb;
+		if (coalesceCommits) {
+			coalescingDb = cx->clone();
+			int64_t delayMicroseconds = deterministicRandom()->randomInt(100, 10000);
+			coalescingDb->setOption(FDBDatabaseOptions::COMMIT_COALESCING_DELAY,
+			                        StringRef((uint8_t*)&delayMicroseconds, sizeof(int64_t)));
+		}
 		for (int c = 0; c < actorCount; c++) {
-			clients.push_back(
-			    timeout(atomicOpWorker(cx->clone(), this, actorCount / transactionsPerSecond), testDuration, Void()));
+			clients.push_back(timeout(atomicOpWorker(coalesceCommits ? coalescingDb : cx->clone(),
+			                                         this,
+			                                         actorCount / transactionsPerSecond),
+			                          testDuration,
+			                          Void()));
 		}
 
 		return delay(testDuration);
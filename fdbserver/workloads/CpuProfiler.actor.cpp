@@ -24,7 +24,8 @@
 #include "fdbserver/workloads/workloads.actor.h"
 #include "flow/actorcompiler.h" // This must be the last #include.
 
-// A workload which starts the CPU profiler at a given time and duration on all workers in a cluster
+// A workload which starts the CPU profiler, or allocation sampling, at a given time and duration on all workers in a
+// cluster
 struct CpuProfilerWorkload : TestWorkload {
 	bool success;
 
@@ -38,6 +39,9 @@ struct CpuProfilerWorkload : TestWorkload {
 	// See Locality.h for the list of valid strings to provide.
 	std::vector<std::string> roles;
 
+	// Which profiler to run: "flow" (the default) or "allocation"
+	ProfilerRequest::Type type;
+
 	// A list of worker interfaces which have had profiling turned on
 	std::vector<WorkerInterface> profilingWorkers;
 
@@ -45,6 +49,9 @@ struct CpuProfilerWorkload : TestWorkload {
 		initialDelay = getOption(options, LiteralStringRef("initialDelay"), 0.0);
 		duration = getOption(options, LiteralStringRef("duration"), -1.0);
 		roles = getOption(options, LiteralStringRef("roles"), std::vector<std::string>());
+		type = getOption(options, LiteralStringRef("type"), LiteralStringRef("flow")) == LiteralStringRef("allocation")
+		           ? ProfilerRequest::Type::ALLOCATION
+		           : ProfilerRequest::Type::FLOW;
 		success = true;
 	}
 
@@ -74,7 +81,7 @@ struct CpuProfilerWorkload : TestWorkload {
 			// Send a ProfilerRequest to each worker
 			for (i = 0; i < self->profilingWorkers.size(); i++) {
 				ProfilerRequest req;
-				req.type = ProfilerRequest::Type::FLOW;
+				req.type = self->type;
 				req.action = enabled ? ProfilerRequest::Action::ENABLE : ProfilerRequest::Action::DISABLE;
 				req.duration = 0; // unused
 
@@ -36,6 +36,7 @@ struct CycleWorkload : TestWorkload {
 	int actorCount, nodeCount;
 	double testDuration, transactionsPerSecond, minExpectedTransactionsPerSecond, traceParentProbability;
 	Key keyPrefix;
+	bool prefetchLocations;
 
 	std::vector<Future<Void>> clients;
 	PerfIntCounter transactions, retries, tooOldRetries, commitFailedRetries;
@@ -50,15 +51,20 @@ struct CycleWorkload : TestWorkload {
 		nodeCount = getOption(options, "nodeCount"_sr, transactionsPerSecond * clientCount);
 		keyPrefix = unprintable(getOption(options, "keyPrefix"_sr, LiteralStringRef("")).toString());
 		traceParentProbability = getOption(options, "traceParentProbability "_sr, 0.01);
+		prefetchLocations = getOption(options, "prefetchLocations"_sr, deterministicRandom()->coinflip());
 		minExpectedTransactionsPerSecond = transactionsPerSecond * getOption(options, "expectedRate"_sr, 0.7);
 	}
 
 	std::string description() const override { return "CycleWorkload"; }
 	Future<Void> setup(Database const& cx) override { return bulkSetup(cx, this, nodeCount, Promise<double>()); }
 	Future<Void> start(Database const& cx) override {
-		for (int c = 0; c < actorCount; c++)
-			clients.push_back(
-			    timeout(cycleClient(cx->clone(), this, actorCount / transactionsPerSecond), testDuration, Void()));
+		for (int c = 0; c < actorCount; c++) {
+			Database db = cx->clone();
+			if (prefetchLocations) {
+				db->setOption(FDBDatabaseOptions::LOCATION_CACHE_PREFETCH_PREFIX, keyPrefix);
+			}
+			clients.push_back(timeout(cycleClient(db, this, actorCount / transactionsPerSecond), testDuration, Void()));
+		}
 		return delay(testDuration);
 	}
 	Future<bool> check(Database const& cx) override {
@@ -0,0 +1,179 @@
+/*
+ * FilteredRangeRead.actor.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fdbclient/NativeAPI.actor.h"
+#include "fdbclient/ReadYourWrites.h"
+#include "fdbclient/Tuple.h"
+#include "fdbserver/TesterInterface.actor.h"
+#include "fdbserver/workloads/workloads.actor.h"
+#include "flow/actorcompiler.h" // This must be the last #include.
+
+// Reads random ranges with random filters, in pages of random sizes, and checks that the rows returned are those of an
+// unfiltered read that match the filter. Some reads are made after uncommitted writes to the range, which have to be
+// filtered by the client.
+struct FilteredRangeReadWorkload : TestWorkload {
+	int nodeCount;
+	int iterations;
+	int valueCount;
+	Key prefix;
+	bool failed = false;
+
+	FilteredRangeReadWorkload(WorkloadContext const& wcx) : TestWorkload(wcx) {
+		nodeCount = getOption(options, "nodeCount"_sr, 2000);
+		iterations = getOption(options, "iterations"_sr, 100);
+		valueCount = getOption(options, "valueCount"_sr, 20);
+		prefix = "FilteredRangeRead/"_sr;
+	}
+
+	std::string description() const override { return "FilteredRangeRead"; }
+
+	Future<Void> setup(Database const& cx) override { return clientId == 0 ? _setup(cx, this) : Void(); }
+	Future<Void> start(Database const& cx) override { return clientId == 0 ? _start(cx, this) : Void(); }
+	Future<bool> check(Database const& cx) override { return !failed; }
+	void getMetrics(std::vector<PerfMetric>& m) override {}
+
+	Key keyFor(int i) const { return StringRef(format("%06d", i)).withPrefix(prefix); }
+
+	Value randomValue() const {
+		if (deterministicRandom()->random01() < 0.1) {
+			return "not a tuple"_sr;
+		}
+		return Tuple()
+		    .append(deterministicRandom()->randomInt(0, valueCount))
+		    .append(StringRef(std::string(1, 'a' + deterministicRandom()->randomInt(0, 3))))
+		    .pack();
+	}
+
+	Standalone<RangeReadFilterRef> randomFilter() const {
+		Standalone<RangeReadFilterRef> filter;
+		if (deterministicRandom()->coinflip()) {
+			int prefixes = deterministicRandom()->randomInt(1, 4);
+			for (int i = 0; i < prefixes; i++) {
+				// Key prefixes of 10 or 100 keys each
+				std::string key = format("%06d", deterministicRandom()->randomInt(0, nodeCount));
+				key.resize(deterministicRandom()->randomInt(4, 6));
+				filter.keyPrefixes.push_back_deep(filter.arena(), StringRef(key).withPrefix(prefix));
+			}
+		}
+		if (deterministicRandom()->random01() < 0.3) {
+			filter.valuePrefix =
+			    StringRef(filter.arena(), Tuple().append(deterministicRandom()->randomInt(0, valueCount)).pack());
+		}
+		if (deterministicRandom()->coinflip()) {
+			filter.tupleElement = deterministicRandom()->randomInt(0, 3);
+			filter.comparison = deterministicRandom()->randomInt(0, RangeReadFilterRef::GREATER_OR_EQUAL + 1);
+			Tuple operand = deterministicRandom()->coinflip()
+			                    ? Tuple().append(deterministicRandom()->randomInt(0, valueCount))
+			                    : Tuple().append(deterministicRandom()->coinflip() ? "a"_sr : "b"_sr);
+			filter.tupleOperand = StringRef(filter.arena(), operand.pack());
+		}
+		return filter;
+	}
+
+	ACTOR static Future<Void> _setup(Database cx, FilteredRangeReadWorkload* self) {
+		state int i = 0;
+		state Transaction tr(cx);
+		while (i < self->nodeCount) {
+			try {
+				for (int j = i; j < std::min(i + 100, self->nodeCount); j++) {
+					tr.set(self->keyFor(j), self->randomValue());
+				}
+				wait(tr.commit());
+				i += 100;
+				tr.reset();
+			} catch (Error& e) {
+				wait(tr.onError(e));
+			}
+		}
+		return Void();
+	}
+
+	ACTOR static Future<Void> checkFilter(Database cx, FilteredRangeReadWorkload* self) {
+		state Standalone<RangeReadFilterRef> filter = self->randomFilter();
+		state int a = deterministicRandom()->randomInt(0, self->nodeCount + 1);
+		state int b = deterministicRandom()->randomInt(0, self->nodeCount + 1);
+		state KeyRange range = KeyRangeRef(self->keyFor(std::min(a, b)), self->keyFor(std::max(a, b)));
+		state int rowLimit = deterministicRandom()->randomInt(1, 100);
+		state int writes = deterministicRandom()->coinflip() ? deterministicRandom()->randomInt(1, 10) : 0;
+		state std::vector<Key> expected;
+		state std::vector<Key> actual;
+		state ReadYourWritesTransaction tr(cx);
+		loop {
+			try {
+				expected.clear();
+				actual.clear();
+				// Never committed
+				for (int j = 0; j < writes; j++) {
+					Key key = self->keyFor(deterministicRandom()->randomInt(0, self->nodeCount));
+					if (deterministicRandom()->random01() < 0.2) {
+						tr.clear(key);
+					} else {
+						tr.set(key, self->randomValue());
+					}
+				}
+				RangeResult all = wait(tr.getRange(range, CLIENT_KNOBS->TOO_MANY));
+				ASSERT(!all.more);
+				for (auto& kv : all) {
+					if (filter.matches(kv.key, kv.value)) {
+						expected.push_back(kv.key);
+					}
+				}
+
+				state Key begin = range.begin;
+				loop {
+					RangeResult page =
+					    wait(tr.getFilteredRange(KeyRangeRef(begin, range.end), filter, GetRangeLimits(rowLimit)));
+					ASSERT(page.size() <= rowLimit);
+					for (auto& kv : page) {
+						ASSERT(filter.matches(kv.key, kv.value));
+						actual.push_back(kv.key);
+					}
+					if (!page.more) {
+						break;
+					}
+					begin = page.readThrough.present() ? Key(page.readThrough.get()) : keyAfter(page.back().key);
+				}
+				break;
+			} catch (Error& e) {
+				wait(tr.onError(e));
+			}
+		}
+
+		if (expected != actual) {
+			TraceEvent(SevError, "FilteredRangeReadMismatch")
+			    .detail("Begin", range.begin)
+			    .detail("End", range.end)
+			    .detail("Expected", expected.size())
+			    .detail("Actual", actual.size());
+			self->failed = true;
+		}
+		return Void();
+	}
+
+	ACTOR static Future<Void> _start(Database cx, FilteredRangeReadWorkload* self) {
+		state int i = 0;
+		for (; i < self->iterations; i++) {
+			wait(checkFilter(cx, self));
+		}
+		return Void();
+	}
+};
+
+WorkloadFactory<FilteredRangeReadWorkload> FilteredRangeReadWorkloadFactory("FilteredRangeRead");
@@ -0,0 +1,190 @@
+/*
+ * PacketCompression.actor.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fdbclient/NativeAPI.actor.h"
+#include "fdbrpc/FlowTransport.h"
+#include "fdbserver/TesterInterface.actor.h"
+#include "fdbserver/workloads/workloads.actor.h"
+#include "flow/actorcompiler.h" // This must be the last #include.
+
+struct PacketCompressionReply {
+	constexpr static FileIdentifier file_identifier = 9176204;
+	Standalone<StringRef> payload;
+	int64_t bytesSaved = 0;
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, payload, bytesSaved);
+	}
+};
+
+struct PacketCompressionRequest {
+	constexpr static FileIdentifier file_identifier = 9176205;
+	int payloadBytes = 0; // 0 asks for the bytes saved so far instead of a payload
+	ReplyPromise<PacketCompressionReply> reply;
+
+	PacketCompressionRequest() {}
+	explicit PacketCompressionRequest(int payloadBytes) : payloadBytes(payloadBytes) {}
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, payloadBytes, reply);
+	}
+};
+
+struct PacketCompressionInterface {
+	constexpr static FileIdentifier file_identifier = 9176206;
+	RequestStream<PacketCompressionRequest> requests;
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, requests);
+	}
+};
+
+// Each client requests large, compressible replies from the next client in rounds, resetting its connection before
+// every round after the first. The replying client then accepts a new connection which replaces the old one, and its
+// replies must still be compressed on it.
+struct PacketCompressionWorkload : TestWorkload {
+	int rounds;
+	int requestsPerRound;
+	int payloadBytes;
+	PacketCompressionInterface interf;
+	int64_t bytesSaved = 0; // Saved by compressing the payloads this client has replied with
+	Future<Void> serverActor;
+	bool failed = false;
+
+	PacketCompressionWorkload(WorkloadContext const& wcx) : TestWorkload(wcx) {
+		rounds = getOption(options, "rounds"_sr, 5);
+		requestsPerRound = getOption(options, "requestsPerRound"_sr, 5);
+		payloadBytes =
+		    getOption(options, "payloadBytes"_sr, std::max(10000, 2 * FLOW_KNOBS->PACKET_COMPRESSION_THRESHOLD));
+	}
+
+	std::string description() const override { return "PacketCompression"; }
+	Future<Void> setup(Database const& cx) override { return persistInterface(this, cx); }
+	Future<Void> start(Database const& cx) override {
+		if (clientCount < 2 || FLOW_KNOBS->PACKET_COMPRESSION_THRESHOLD <= 0) {
+			TraceEvent("PacketCompressionSkipped")
+			    .detail("ClientCount", clientCount)
+			    .detail("Threshold", FLOW_KNOBS->PACKET_COMPRESSION_THRESHOLD);
+			return Void();
+		}
+		serverActor = serve(this);
+		return requester(this, cx);
+	}
+	Future<bool> check(Database const& cx) override { return !failed; }
+	void getMetrics(std::vector<PerfMetric>& m) override {}
+
+	static Key interfaceKey(int clientId) { return StringRef(format("PacketCompression/Client/%d", clientId)); }
+
+	static int64_t bytesSavedFor(NetworkAddress const& address) {
+		auto& peers = FlowTransport::transport().getAllPeers();
+		auto it = peers.find(address);
+		return it != peers.end() ? it->second->compressionBytesSaved : 0;
+	}
+
+	ACTOR static Future<Void> persistInterface(PacketCompressionWorkload* self, Database cx) {
+		state Transaction tr(cx);
+		loop {
+			try {
+				tr.set(interfaceKey(self->clientId), BinaryWriter::toValue(self->interf, IncludeVersion()));
+				wait(tr.commit());
+				return Void();
+			} catch (Error& e) {
+				wait(tr.onError(e));
+			}
+		}
+	}
+
+	ACTOR static Future<PacketCompressionInterface> fetchInterface(PacketCompressionWorkload* self, Database cx) {
+		state Transaction tr(cx);
+		loop {
+			try {
+				Optional<Value> val = wait(tr.get(interfaceKey((self->clientId + 1) % self->clientCount)));
+				if (!val.present()) {
+					throw operation_failed();
+				}
+				PacketCompressionInterface interf;
+				BinaryReader br(val.get(), IncludeVersion());
+				br >> interf;
+				return interf;
+			} catch (Error& e) {
+				wait(tr.onError(e));
+			}
+		}
+	}
+
+	ACTOR static Future<Void> serve(PacketCompressionWorkload* self) {
+		loop {
+			PacketCompressionRequest req = waitNext(self->interf.requests.getFuture());
+			PacketCompressionReply reply;
+			if (req.payloadBytes == 0) {
+				reply.bytesSaved = self->bytesSaved;
+				req.reply.send(reply);
+				continue;
+			}
+			reply.payload = makeString(req.payloadBytes);
+			memset(mutateString(reply.payload), 'x', req.payloadBytes);
+			// The reply is written, and compressed if at all, before send() returns
+			NetworkAddress address = req.reply.getEndpoint().getPrimaryAddress();
+			int64_t before = bytesSavedFor(address);
+			req.reply.send(reply);
+			self->bytesSaved += std::max<int64_t>(0, bytesSavedFor(address) - before);
+		}
+	}
+
+	ACTOR static Future<Void> requester(PacketCompressionWorkload* self, Database cx) {
+		state PacketCompressionInterface server = wait(fetchInterface(self, cx));
+		state int64_t lastBytesSaved = 0;
+		state int round = 0;
+		for (; round < self->rounds; round++) {
+			if (round > 0) {
+				FlowTransport::transport().resetConnection(server.requests.getEndpoint().getPrimaryAddress());
+			}
+			try {
+				state int i = 0;
+				for (; i < self->requestsPerRound; i++) {
+					PacketCompressionReply reply = wait(
+					    timeoutError(server.requests.getReply(PacketCompressionRequest(self->payloadBytes)), 30.0));
+					ASSERT(reply.payload.size() == self->payloadBytes);
+				}
+				PacketCompressionReply report =
+				    wait(timeoutError(server.requests.getReply(PacketCompressionRequest(0)), 30.0));
+				if (report.bytesSaved <= lastBytesSaved) {
+					TraceEvent(SevError, "PacketCompressionNothingSaved")
+					    .detail("Round", round)
+					    .detail("BytesSaved", report.bytesSaved);
+					self->failed = true;
+				}
+				lastBytesSaved = report.bytesSaved;
+			} catch (Error& e) {
+				if (e.code() != error_code_timed_out && e.code() != error_code_request_maybe_delivered) {
+					throw;
+				}
+				// The connection failed for another reason during this round, which is then not checked
+				TraceEvent("PacketCompressionRoundFailed").error(e).detail("Round", round);
+			}
+		}
+		return Void();
+	}
+};
+
+WorkloadFactory<PacketCompressionWorkload> PacketCompressionWorkloadFactory("PacketCompression");
@@ -259,6 +259,21 @@ struct RYWPerformanceWorkload : TestWorkload {
 		}
 	}
 
+	ACTOR static Future<Void> test_blind_sets(Database cx, RYWPerformanceWorkload* self) {
+		state int i;
+		state ReadYourWritesTransaction tr(cx);
+
+		state double startTime = timer();
+
+		for (i = 0; i < self->nodes; i++) {
+			tr.set(self->keyForIndex(i), LiteralStringRef("foo"));
+		}
+
+		fprintf(stderr, "%f", self->nodes / (timer() - startTime));
+
+		return Void();
+	}
+
 	ACTOR static Future<Void> _start(Database cx, RYWPerformanceWorkload* self) {
 		state int i;
 		fprintf(stderr, "test_get_single, ");
@@ -293,6 +308,9 @@ struct RYWPerformanceWorkload : TestWorkload {
 			else
 				fprintf(stderr, ", ");
 		}
+		fprintf(stderr, "test_blind_sets, ");
+		wait(self->test_blind_sets(cx, self));
+		fprintf(stderr, "\n");
 		return Void();
 	}
 
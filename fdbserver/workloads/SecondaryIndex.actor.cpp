@@ -0,0 +1,165 @@
+/*
+ * SecondaryIndex.actor.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fdbclient/ManagementAPI.actor.h"
+#include "fdbclient/NativeAPI.actor.h"
+#include "fdbclient/SystemData.h"
+#include "fdbclient/Tuple.h"
+#include "fdbserver/TesterInterface.actor.h"
+#include "fdbserver/workloads/workloads.actor.h"
+#include "flow/actorcompiler.h" // This must be the last #include.
+
+// Writes records under a secondary index maintained by the cluster, some of them before the index is created, and
+// checks that the index matches the records once the index writer has caught up.
+struct SecondaryIndexWorkload : TestWorkload {
+	double testDuration;
+	int recordCount;
+	int valueCount;
+	Key indexName;
+	SecondaryIndexDefinition definition;
+
+	SecondaryIndexWorkload(WorkloadContext const& wcx) : TestWorkload(wcx) {
+		testDuration = getOption(options, "testDuration"_sr, 10.0);
+		recordCount = getOption(options, "recordCount"_sr, 1000);
+		valueCount = getOption(options, "valueCount"_sr, 10);
+		indexName = "SecondaryIndexWorkload"_sr;
+		definition = SecondaryIndexDefinition(Tuple().append("SecondaryIndexWorkload"_sr).append("RECORD"_sr).pack(),
+		                                      Tuple().append("SecondaryIndexWorkload"_sr).append("INDEX"_sr).pack(),
+		                                      0);
+	}
+
+	std::string description() const override { return "SecondaryIndex"; }
+
+	Future<Void> setup(Database const& cx) override { return clientId == 0 ? _setup(cx, this) : Void(); }
+	Future<Void> start(Database const& cx) override { return clientId == 0 ? _start(cx, this) : Void(); }
+	Future<bool> check(Database const& cx) override { return clientId == 0 ? _check(cx, this) : true; }
+	void getMetrics(std::vector<PerfMetric>& m) override {}
+
+	Key recordKey(int i) const { return Tuple().append(i).pack().withPrefix(definition.recordPrefix); }
+	Value recordValue() const {
+		return Tuple().append(deterministicRandom()->randomInt(0, valueCount)).append("payload"_sr).pack();
+	}
+
+	// Sets or clears a few random records, sometimes clearing a range of them or writing a value without an index entry
+	ACTOR static Future<Version> changeRecords(Database cx, SecondaryIndexWorkload* self) {
+		state Transaction tr(cx);
+		loop {
+			try {
+				for (int i = 0; i < 10; i++) {
+					int record = deterministicRandom()->randomInt(0, self->recordCount);
+					double choice = deterministicRandom()->random01();
+					if (choice < 0.7) {
+						tr.set(self->recordKey(record), self->recordValue());
+					} else if (choice < 0.8) {
+						tr.set(self->recordKey(record), "not a tuple"_sr);
+					} else if (choice < 0.9) {
+						tr.clear(self->recordKey(record));
+					} else if (choice < 0.98) {
+						tr.clear(KeyRangeRef(self->recordKey(record), self->recordKey(record + 10)));
+					} else {
+						// Large enough to take the index writer several transactions
+						tr.clear(KeyRangeRef(self->recordKey(record), self->recordKey(record + 500)));
+					}
+				}
+				wait(tr.commit());
+				return tr.getCommittedVersion();
+			} catch (Error& e) {
+				wait(tr.onError(e));
+			}
+		}
+	}
+
+	ACTOR static Future<Void> _setup(Database cx, SecondaryIndexWorkload* self) {
+		state int i = 0;
+		for (; i < self->recordCount / 10; i++) {
+			wait(success(changeRecords(cx, self)));
+		}
+		wait(createSecondaryIndex(cx, self->indexName, self->definition));
+		return Void();
+	}
+
+	ACTOR static Future<Void> _start(Database cx, SecondaryIndexWorkload* self) {
+		state double end = now() + self->testDuration;
+		while (now() < end) {
+			wait(success(changeRecords(cx, self)));
+			wait(delay(deterministicRandom()->random01() * 0.1));
+		}
+		return Void();
+	}
+
+	ACTOR static Future<bool> _check(Database cx, SecondaryIndexWorkload* self) {
+		// Every mutation up to the last change has been applied once the index writer's progress passes it
+		state Version lastChange = wait(changeRecords(cx, self));
+		state Transaction tr(cx);
+		state RangeResult records;
+		state RangeResult index;
+		loop {
+			try {
+				tr.setOption(FDBTransactionOptions::ACCESS_SYSTEM_KEYS);
+				Optional<Value> progress = wait(tr.get(secondaryIndexProgressKeyFor(self->indexName)));
+				if (progress.present() &&
+				    BinaryReader::fromStringRef<Version>(progress.get(), Unversioned()) > lastChange) {
+					break;
+				}
+				wait(delay(1.0));
+				tr.reset();
+			} catch (Error& e) {
+				wait(tr.onError(e));
+			}
+		}
+
+		tr.reset();
+		loop {
+			try {
+				RangeResult _records = wait(tr.getRange(self->definition.recordRange(), CLIENT_KNOBS->TOO_MANY));
+				records = _records;
+				RangeResult _index = wait(tr.getRange(self->definition.indexRange(), CLIENT_KNOBS->TOO_MANY));
+				index = _index;
+				break;
+			} catch (Error& e) {
+				wait(tr.onError(e));
+			}
+		}
+
+		std::set<Key> expected;
+		for (auto& record : records) {
+			Optional<Key> entry = self->definition.indexEntryFor(record.key, record.value);
+			if (entry.present()) {
+				expected.insert(entry.get());
+			}
+		}
+		std::set<Key> actual;
+		for (auto& entry : index) {
+			actual.insert(entry.key);
+		}
+		if (expected != actual) {
+			TraceEvent(SevError, "SecondaryIndexMismatch")
+			    .detail("Records", records.size())
+			    .detail("Expected", expected.size())
+			    .detail("Actual", actual.size());
+			return false;
+		}
+
+		wait(dropSecondaryIndex(cx, self->indexName));
+		return true;
+	}
+};
+
+WorkloadFactory<SecondaryIndexWorkload> SecondaryIndexWorkloadFactory("SecondaryIndex");
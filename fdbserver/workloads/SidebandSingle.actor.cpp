@@ -28,13 +28,14 @@
  * This workload is modelled off the Sideband workload, except it uses a single
  * mutator and checker rather than several. In addition to ordinary consistency checks,
  * it also checks the consistency of the cached read versions when using the
- * USE_GRV_CACHE transaction option, specifically when commit_unknown_result
+ * USE_GRV_CACHE or MAX_READ_VERSION_STALENESS transaction options, specifically when commit_unknown_result
  * produces a maybe/maybe-not written scenario. It makes sure that a cached read of an
  * unknown result matches the regular read of that same key and is not too stale.
  */
 
 struct SidebandSingleWorkload : TestWorkload {
 	double testDuration, operationsPerSecond;
+	bool useStalenessBound;
 	// Pair represents <Key, commitVersion>
 	PromiseStream<std::pair<uint64_t, Version>> interf;
 
@@ -46,6 +47,8 @@ struct SidebandSingleWorkload : TestWorkload {
 	    keysUnexpectedlyPresent("KeysUnexpectedlyPresent") {
 		testDuration = getOption(options, LiteralStringRef("testDuration"), 10.0);
 		operationsPerSecond = getOption(options, LiteralStringRef("operationsPerSecond"), 50.0);
+		useStalenessBound =
+		    getOption(options, LiteralStringRef("useStalenessBound"), deterministicRandom()->coinflip());
 	}
 
 	std::string description() const override { return "SidebandSingleWorkload"; }
@@ -135,7 +138,13 @@ struct SidebandSingleWorkload : TestWorkload {
 			state Transaction tr(cx);
 			loop {
 				try {
-					tr.setOption(FDBTransactionOptions::USE_GRV_CACHE);
+					if (self->useStalenessBound) {
+						int64_t stalenessMs = 5000;
+						tr.setOption(FDBTransactionOptions::MAX_READ_VERSION_STALENESS,
+						             StringRef((uint8_t*)&stalenessMs, sizeof(int64_t)));
+					} else {
+						tr.setOption(FDBTransactionOptions::USE_GRV_CACHE);
+					}
 					state Optional<Value> val = wait(tr.get(messageKey));
 					if (!val.present()) {
 						TraceEvent(SevError, "CausalConsistencyError1")
@@ -300,6 +300,102 @@ void* ArenaBlock::allocate(Reference<ArenaBlock>& self, int bytes) {
 	return result;
 }
 
+namespace {
+// Arena blocks of 512 to 8192 bytes come from operator new rather than FastAllocator. Whole blocks of these sizes are
+// kept on a per-thread free list when released, so that arena-heavy paths (deserializing replies, building mutation
+// batches) reuse warm blocks instead of going to malloc for each one. A block released on another thread than the one
+// that allocated it goes to the releasing thread's list. Cached bytes are reported as unused allocated memory.
+#if !VALGRIND && !defined(USE_SANITIZER)
+class ArenaBlockCache {
+	static constexpr int MIN_SIZE_LOG2 = 9;
+	static constexpr int MAX_SIZE_LOG2 = 13;
+	static constexpr int CLASSES = MAX_SIZE_LOG2 - MIN_SIZE_LOG2 + 1;
+	static constexpr int MAX_CACHED_BYTES_PER_CLASS = 256 << 10;
+
+	struct FreeBlock {
+		FreeBlock* next;
+	};
+	FreeBlock* freeLists[CLASSES] = {};
+	int counts[CLASSES] = {};
+
+	static int sizeClass(int size) {
+		int c = 0;
+		while ((1 << (MIN_SIZE_LOG2 + c)) < size) {
+			++c;
+		}
+		return c;
+	}
+
+public:
+	~ArenaBlockCache();
+
+	// size must be a power of two in [512, 8192]
+	void* allocate(int size) {
+		int c = sizeClass(size);
+		if (FreeBlock* b = freeLists[c]) {
+			freeLists[c] = b->next;
+			--counts[c];
+			g_cachedArenaBlockMemory.fetch_sub(size);
+			return b;
+		}
+		return new uint8_t[size];
+	}
+	void release(void* p, int size) {
+		int c = sizeClass(size);
+		if (counts[c] * size >= MAX_CACHED_BYTES_PER_CLASS) {
+			delete[] reinterpret_cast<uint8_t*>(p);
+			return;
+		}
+		FreeBlock* b = reinterpret_cast<FreeBlock*>(p);
+		b->next = freeLists[c];
+		freeLists[c] = b;
+		++counts[c];
+		g_cachedArenaBlockMemory.fetch_add(size);
+	}
+};
+thread_local ArenaBlockCache arenaBlockCache;
+// Set once arenaBlockCache has been destroyed on this thread, so that arenas released by later thread_local or static
+// destructors free their blocks directly instead of touching the destroyed cache. A bool is trivially destructible, so
+// it stays usable for the rest of the thread's life.
+thread_local bool arenaBlockCacheDestroyed = false;
+
+ArenaBlockCache::~ArenaBlockCache() {
+	for (int c = 0; c < CLASSES; c++) {
+		while (FreeBlock* b = freeLists[c]) {
+			freeLists[c] = b->next;
+			delete[] reinterpret_cast<uint8_t*>(b);
+		}
+		g_cachedArenaBlockMemory.fetch_sub(int64_t(counts[c]) << (MIN_SIZE_LOG2 + c));
+		counts[c] = 0;
+	}
+	arenaBlockCacheDestroyed = true;
+}
+
+void* allocateMidsizeBlock(int size) {
+	sampleAllocation(size, "ArenaBlock");
+	if (arenaBlockCacheDestroyed) {
+		return new uint8_t[size];
+	}
+	return arenaBlockCache.allocate(size);
+}
+void releaseMidsizeBlock(void* p, int size) {
+	if (arenaBlockCacheDestroyed) {
+		delete[] reinterpret_cast<uint8_t*>(p);
+		return;
+	}
+	arenaBlockCache.release(p, size);
+}
+#else
+void* allocateMidsizeBlock(int size) {
+	sampleAllocation(size, "ArenaBlock");
+	return new uint8_t[size];
+}
+void releaseMidsizeBlock(void* p, int) {
+	delete[] reinterpret_cast<uint8_t*>(p);
+}
+#endif
+} // namespace
+
 // Return an appropriately-sized ArenaBlock to store the given data
 ArenaBlock* ArenaBlock::create(int dataSize, Reference<ArenaBlock>& next) {
 	ArenaBlock* b;
@@ -340,23 +436,23 @@ ArenaBlock* ArenaBlock::create(int dataSize, Reference<ArenaBlock>& next) {
 				b->bigSize = 256;
 				INSTRUMENT_ALLOCATE("Arena256");
 			} else if (reqSize <= 512) {
-				b = (ArenaBlock*)new uint8_t[512];
+				b = (ArenaBlock*)allocateMidsizeBlock(512);
 				b->bigSize = 512;
 				INSTRUMENT_ALLOCATE("Arena512");
 			} else if (reqSize <= 1024) {
-				b = (ArenaBlock*)new uint8_t[1024];
+				b = (ArenaBlock*)allocateMidsizeBlock(1024);
 				b->bigSize = 1024;
 				INSTRUMENT_ALLOCATE("Arena1024");
 			} else if (reqSize <= 2048) {
-				b = (ArenaBlock*)new uint8_t[2048];
+				b = (ArenaBlock*)allocateMidsizeBlock(2048);
 				b->bigSize = 2048;
 				INSTRUMENT_ALLOCATE("Arena2048");
 			} else if (reqSize <= 4096) {
-				b = (ArenaBlock*)new uint8_t[4096];
+				b = (ArenaBlock*)allocateMidsizeBlock(4096);
 				b->bigSize = 4096;
 				INSTRUMENT_ALLOCATE("Arena4096");
 			} else {
-				b = (ArenaBlock*)new uint8_t[8192];
+				b = (ArenaBlock*)allocateMidsizeBlock(8192);
 				b->bigSize = 8192;
 				INSTRUMENT_ALLOCATE("Arena8192");
 			}
@@ -367,6 +463,7 @@ ArenaBlock* ArenaBlock::create(int dataSize, Reference<ArenaBlock>& next) {
 #ifdef ALLOC_INSTRUMENTATION
 			allocInstr["ArenaHugeKB"].alloc((reqSize + 1023) >> 10);
 #endif
+			sampleAllocation(reqSize, "HugeArenaBlock");
 			b = (ArenaBlock*)new uint8_t[reqSize];
 			b->tinySize = b->tinyUsed = NOT_TINY;
 			b->bigSize = reqSize;
@@ -455,19 +552,19 @@ void ArenaBlock::destroyLeaf() {
 			FastAllocator<256>::release(this);
 			INSTRUMENT_RELEASE("Arena256");
 		} else if (bigSize <= 512) {
-			delete[] reinterpret_cast<uint8_t*>(this);
+			releaseMidsizeBlock(this, 512);
 			INSTRUMENT_RELEASE("Arena512");
 		} else if (bigSize <= 1024) {
-			delete[] reinterpret_cast<uint8_t*>(this);
+			releaseMidsizeBlock(this, 1024);
 			INSTRUMENT_RELEASE("Arena1024");
 		} else if (bigSize <= 2048) {
-			delete[] reinterpret_cast<uint8_t*>(this);
+			releaseMidsizeBlock(this, 2048);
 			INSTRUMENT_RELEASE("Arena2048");
 		} else if (bigSize <= 4096) {
-			delete[] reinterpret_cast<uint8_t*>(this);
+			releaseMidsizeBlock(this, 4096);
 			INSTRUMENT_RELEASE("Arena4096");
 		} else if (bigSize <= 8192) {
-			delete[] reinterpret_cast<uint8_t*>(this);
+			releaseMidsizeBlock(this, 8192);
 			INSTRUMENT_RELEASE("Arena8192");
 		} else {
 #ifdef ALLOC_INSTRUMENTATION
@@ -671,6 +768,32 @@ TEST_CASE("/flow/Arena/DefaultBoostHash") {
 	return Void();
 }
 
+TEST_CASE("/flow/Arena/BlockRecycling") {
+	// Mid-size blocks released on this thread are handed back out, and must come back with their contents intact
+	// through a fresh arena
+	for (int size : { 400, 900, 1900, 4000, 8000 }) {
+		for (int i = 0; i < 10; ++i) {
+			Standalone<StringRef> s = makeString(size);
+			memset(mutateString(s), 'a' + i, size);
+			Arena a;
+			StringRef copy(a, s);
+			ASSERT(copy == s);
+		}
+	}
+	std::vector<Standalone<StringRef>> live;
+	for (int i = 0; i < 1000; ++i) {
+		live.push_back(makeString(deterministicRandom()->randomInt(300, 8000)));
+		memset(mutateString(live.back()), i & 0xff, live.back().size());
+	}
+	for (int i = 0; i < live.size(); ++i) {
+		const uint8_t* p = live[i].begin();
+		for (int j = 0; j < live[i].size(); ++j) {
+			ASSERT(p[j] == (i & 0xff));
+		}
+	}
+	return Void();
+}
+
 TEST_CASE("/flow/Arena/Size") {
 	Arena a;
 	int fastSize, slowSize;
@@ -49,6 +49,9 @@ public:
 private:
 	Net2* network;
 	boost::asio::deadline_timer firstTimer;
+	double spinBudget;
+
+	bool spin(double spinTime);
 
 	static void nullWaitHandler(const boost::system::error_code&) {}
 	static void nullCompletionHandler() {}
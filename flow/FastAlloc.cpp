@@ -28,8 +28,10 @@
 #include "flow/crc32c.h"
 #include "flow/flow.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
+#include <cstring>
 #include <unordered_map>
 
 //#ifdef WIN32
@@ -113,6 +115,7 @@ template <int Size>
 void* FastAllocator<Size>::freelist = nullptr;
 
 std::atomic<int64_t> g_hugeArenaMemory(0);
+std::atomic<int64_t> g_cachedArenaBlockMemory(0);
 
 double hugeArenaLastLogged = 0;
 std::map<std::string, std::pair<int, int64_t>> hugeArenaTraces;
@@ -135,6 +138,128 @@ void hugeArenaSample(int size) {
 	}
 }
 
+namespace {
+constexpr int64_t ALLOCATION_SAMPLING_RECHECK_BYTES = 1 << 20;
+constexpr int ALLOCATION_SAMPLE_SLOTS = 4096;
+constexpr int ALLOCATION_SAMPLE_PROBES = 16;
+constexpr int ALLOCATION_SAMPLE_MAX_DEPTH = 24;
+
+// A slot is claimed by the first sampler to CAS its key from 0, which then fills in the stack and publishes it by
+// storing depth. Counters are updated with relaxed atomics, so any thread may sample without taking a lock.
+struct AllocationSampleSlot {
+	std::atomic<uint64_t> key{ 0 };
+	std::atomic<int> depth{ 0 };
+	std::atomic<int64_t> samples{ 0 };
+	std::atomic<int64_t> bytes{ 0 };
+	const char* source = nullptr;
+	int64_t size = 0; // of the first sample
+	void* frames[ALLOCATION_SAMPLE_MAX_DEPTH];
+};
+
+std::atomic<int64_t> g_allocationSamplingBytes(0);
+std::atomic<int64_t> g_droppedAllocationSamples(0);
+AllocationSampleSlot* allocationSampleTable() {
+	static AllocationSampleSlot* table = new AllocationSampleSlot[ALLOCATION_SAMPLE_SLOTS];
+	return table;
+}
+thread_local bool inAllocationSample = false;
+} // namespace
+
+thread_local int64_t g_allocationSampleCountdown = ALLOCATION_SAMPLING_RECHECK_BYTES;
+
+void setAllocationSampling(int64_t bytesPerSample) {
+	if (bytesPerSample > 0 && g_allocationSamplingBytes.load() == 0) {
+		AllocationSampleSlot* table = allocationSampleTable();
+		for (int i = 0; i < ALLOCATION_SAMPLE_SLOTS; i++) {
+			table[i].depth = 0;
+			table[i].samples = 0;
+			table[i].bytes = 0;
+			table[i].key = 0;
+		}
+		g_droppedAllocationSamples = 0;
+	}
+	g_allocationSamplingBytes = std::max<int64_t>(bytesPerSample, 0);
+	// Other threads pick up the new rate at their next sample or recheck
+	g_allocationSampleCountdown = bytesPerSample > 0 ? bytesPerSample : ALLOCATION_SAMPLING_RECHECK_BYTES;
+}
+
+void sampleAllocationSlow(int64_t size, const char* source) {
+	int64_t rate = g_allocationSamplingBytes.load(std::memory_order_relaxed);
+	if (rate == 0 || inAllocationSample) {
+		g_allocationSampleCountdown = rate ? rate : ALLOCATION_SAMPLING_RECHECK_BYTES;
+		return;
+	}
+	g_allocationSampleCountdown = rate;
+	inAllocationSample = true;
+
+	void* frames[ALLOCATION_SAMPLE_MAX_DEPTH];
+	int depth = platform::raw_backtrace(frames, ALLOCATION_SAMPLE_MAX_DEPTH);
+	uint32_t h1 = 0, h2 = uint32_t(uintptr_t(source));
+	hashlittle2(frames, depth * sizeof(void*), &h1, &h2);
+	uint64_t key = ((uint64_t(h1) << 32) | h2) | 1;
+
+	AllocationSampleSlot* table = allocationSampleTable();
+	bool recorded = false;
+	for (int i = 0; i < ALLOCATION_SAMPLE_PROBES && !recorded; i++) {
+		AllocationSampleSlot& slot = table[(key + i) % ALLOCATION_SAMPLE_SLOTS];
+		uint64_t expected = 0;
+		if (slot.key.compare_exchange_strong(expected, key)) {
+			std::copy(frames, frames + depth, slot.frames);
+			slot.source = source;
+			slot.size = size;
+			slot.depth.store(depth, std::memory_order_release);
+			expected = key;
+		}
+		if (expected == key) {
+			slot.samples.fetch_add(1, std::memory_order_relaxed);
+			slot.bytes.fetch_add(std::max(rate, size), std::memory_order_relaxed);
+			recorded = true;
+		}
+	}
+	if (!recorded) {
+		++g_droppedAllocationSamples;
+	}
+	inAllocationSample = false;
+}
+
+std::vector<AllocationSiteSample> getAllocationSamples(int topN) {
+	AllocationSampleSlot* table = allocationSampleTable();
+	std::vector<std::pair<int64_t, int>> bySize;
+	for (int i = 0; i < ALLOCATION_SAMPLE_SLOTS; i++) {
+		if (table[i].depth.load(std::memory_order_acquire) > 0) {
+			bySize.emplace_back(table[i].bytes.load(std::memory_order_relaxed), i);
+		}
+	}
+	std::sort(bySize.begin(), bySize.end(), std::greater<>());
+	std::vector<AllocationSiteSample> sites;
+	for (int i = 0; i < bySize.size() && i < topN; i++) {
+		AllocationSampleSlot& slot = table[bySize[i].second];
+		sites.push_back(AllocationSiteSample{ slot.source,
+		                                      slot.size,
+		                                      slot.samples.load(),
+		                                      bySize[i].first,
+		                                      platform::format_backtrace(slot.frames, slot.depth.load()) });
+	}
+	return sites;
+}
+
+void logAllocationSamples(int topN) {
+	std::vector<AllocationSiteSample> sites = getAllocationSamples(topN);
+	for (int i = 0; i < sites.size(); i++) {
+		TraceEvent("AllocationSample")
+		    .detail("Rank", i)
+		    .detail("Source", sites[i].source)
+		    .detail("ExampleSize", sites[i].exampleSize)
+		    .detail("Samples", sites[i].samples)
+		    .detail("EstimatedBytes", sites[i].estimatedBytes)
+		    .detail("Backtrace", sites[i].backtrace);
+	}
+	TraceEvent("AllocationSamplingSummary")
+	    .detail("BytesPerSample", g_allocationSamplingBytes.load())
+	    .detail("CallSites", sites.size())
+	    .detail("DroppedSamples", g_droppedAllocationSamples.load());
+}
+
 #ifdef ALLOC_INSTRUMENTATION
 INIT_SEG std::map<const char*, AllocInstrInfo> allocInstr;
 INIT_SEG std::unordered_map<int64_t, std::pair<uint32_t, size_t>> memSample;
@@ -354,6 +479,7 @@ void* FastAllocator<Size>::allocate() {
 #if defined(ALLOC_INSTRUMENTATION) || defined(ALLOC_INSTRUMENTATION_STDOUT)
 	recordAllocation(p, Size);
 #endif
+	sampleAllocation(Size, "FastAllocator");
 	return p;
 }
 
@@ -573,6 +699,7 @@ int64_t getTotalUnusedAllocatedMemory() {
 	unusedMemory += FastAllocator<4096>::getApproximateMemoryUnused();
 	unusedMemory += FastAllocator<8192>::getApproximateMemoryUnused();
 	unusedMemory += FastAllocator<16384>::getApproximateMemoryUnused();
+	unusedMemory += g_cachedArenaBlockMemory.load();
 
 	return unusedMemory;
 }
@@ -615,4 +742,41 @@ TEST_CASE("/jemalloc/4k_aligned_usable_size") {
 	}
 	return Void();
 }
-#endif
\ No newline at end of file
+#endif
+
+TEST_CASE("/flow/FastAllocator/AllocationSampling") {
+	setAllocationSampling(100);
+	for (int i = 0; i < 1000; ++i) {
+		sampleAllocation(10, "SamplingTest");
+	}
+	int64_t samples = 0, bytes = 0;
+	AllocationSampleSlot* table = allocationSampleTable();
+	for (int i = 0; i < ALLOCATION_SAMPLE_SLOTS; ++i) {
+		if (table[i].depth.load() > 0 && !strcmp(table[i].source, "SamplingTest")) {
+			samples += table[i].samples.load();
+			bytes += table[i].bytes.load();
+		}
+	}
+	// Each sample resets the countdown, so one in every 11 allocations of 10 bytes is sampled
+	ASSERT(samples > 80 && samples <= 90);
+	ASSERT(bytes == samples * 100);
+	int64_t reported = 0;
+	for (auto& site : getAllocationSamples(ALLOCATION_SAMPLE_SLOTS)) {
+		if (!strcmp(site.source, "SamplingTest")) {
+			ASSERT(site.exampleSize == 10);
+			reported += site.samples;
+		}
+	}
+	ASSERT(reported == samples);
+	logAllocationSamples(1);
+
+	// Disabled sampling records nothing
+	setAllocationSampling(0);
+	for (int i = 0; i < 1000; ++i) {
+		sampleAllocation(1 << 20, "SamplingTestDisabled");
+	}
+	for (int i = 0; i < ALLOCATION_SAMPLE_SLOTS; ++i) {
+		ASSERT(table[i].depth.load() == 0 || strcmp(table[i].source, "SamplingTestDisabled"));
+	}
+	return Void();
+}
@@ -173,7 +173,33 @@ private:
 };
 
 extern std::atomic<int64_t> g_hugeArenaMemory;
+// Bytes of released arena blocks held in per-thread caches for reuse
+extern std::atomic<int64_t> g_cachedArenaBlockMemory;
 void hugeArenaSample(int size);
+
+// Runtime allocation sampling. While enabled, about one allocation per bytesPerSample bytes allocated on each thread
+// records its call stack in a fixed-size table, keyed by the stack and source. Sampling is off
+// (bytesPerSample == 0) by default, in which case each thread only rechecks the setting once per megabyte allocated.
+// Enabling sampling clears the table.
+void setAllocationSampling(int64_t bytesPerSample);
+struct AllocationSiteSample {
+	const char* source;
+	int64_t exampleSize; // of the first allocation sampled at this site
+	int64_t samples;
+	int64_t estimatedBytes;
+	std::string backtrace;
+};
+// Returns the topN recorded call sites by estimated bytes allocated
+std::vector<AllocationSiteSample> getAllocationSamples(int topN);
+// Traces the topN recorded call sites by estimated bytes allocated as AllocationSample events
+void logAllocationSamples(int topN);
+void sampleAllocationSlow(int64_t size, const char* source);
+extern thread_local int64_t g_allocationSampleCountdown;
+inline void sampleAllocation(int64_t size, const char* source) {
+	if ((g_allocationSampleCountdown -= size) < 0) {
+		sampleAllocationSlow(size, source);
+	}
+}
 void releaseAllThreadMagazines();
 int64_t getTotalUnusedAllocatedMemory();
 
@@ -21,6 +21,10 @@
 #include "flow/IThreadPool.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #define BOOST_SYSTEM_NO_LIB
 #define BOOST_DATE_TIME_NO_LIB
 #define BOOST_REGEX_NO_LIB
@@ -114,8 +118,220 @@ public:
 	int priority() const { return pri; }
 };
 
+// Each thread has its own queues of actions. post() spreads actions over the threads round-robin, and a thread
+// whose queues are empty takes actions from the back of another thread's queues, so a long action only holds up the
+// actions behind it until some other thread is idle. Actions are split into two classes by ThreadAction::getPriority();
+// a thread always drains the foreground class first. Busy time and steal counts are traced as ThreadPoolMetrics.
+class WorkStealingThreadPool final : public IThreadPool, public ReferenceCounted<WorkStealingThreadPool> {
+	static constexpr int MAX_THREADS = 256;
+	enum { Foreground = 0, Background = 1, PriorityClasses = 2 };
+
+	struct Thread {
+		WorkStealingThreadPool* pool;
+		int index;
+		IThreadPoolReceiver* userObject;
+		THREAD_HANDLE handle; // Owned by main thread
+		std::mutex mutex; // Protects queues
+		std::deque<PThreadAction> queues[PriorityClasses];
+		Thread(WorkStealingThreadPool* pool, int index, IThreadPoolReceiver* userObject)
+		  : pool(pool), index(index), userObject(userObject) {}
+		~Thread() { ASSERT_ABORT(!userObject); }
+
+		PThreadAction popFront() {
+			std::lock_guard<std::mutex> lock(mutex);
+			for (auto& q : queues) {
+				if (!q.empty()) {
+					PThreadAction action = q.front();
+					q.pop_front();
+					return action;
+				}
+			}
+			return nullptr;
+		}
+		PThreadAction popBack() {
+			std::lock_guard<std::mutex> lock(mutex);
+			for (auto& q : queues) {
+				if (!q.empty()) {
+					PThreadAction action = q.back();
+					q.pop_back();
+					return action;
+				}
+			}
+			return nullptr;
+		}
+
+		void run() {
+			setThreadPriority(pool->pri);
+			try {
+				userObject->init();
+				while (PThreadAction action = pool->next(this)) {
+					double begin = timer_monotonic();
+					(*action)(userObject);
+					pool->busyNanos += int64_t((timer_monotonic() - begin) * 1e9);
+					++pool->executed;
+				}
+			} catch (Error& e) {
+				TraceEvent(SevError, "ThreadPoolError").error(e);
+			}
+			delete userObject;
+			userObject = nullptr;
+		}
+	};
+	THREAD_FUNC start(void* p) {
+		((Thread*)p)->run();
+		THREAD_RETURN;
+	}
+
+	// threads[0, threadCount) are read by worker threads while stealing, so threads are never moved or removed
+	// before stop()
+	Thread* threads[MAX_THREADS];
+	std::atomic<int> threadCount;
+	std::atomic<uint32_t> nextThread;
+	std::atomic<int64_t> queued;
+	std::atomic<bool> running;
+	std::mutex idleMutex;
+	std::condition_variable idle;
+	int stackSize;
+	int pri;
+	std::string name;
+
+	std::atomic<int64_t> executed;
+	std::atomic<int64_t> stolen;
+	std::atomic<int64_t> busyNanos;
+	double lastMetricsTime;
+	int64_t lastBusyNanos;
+
+	// Returns the next action for self to run, or nullptr once the pool is stopped
+	PThreadAction next(Thread* self) {
+		while (running.load(std::memory_order_relaxed)) {
+			PThreadAction action = self->popFront();
+			int count = threadCount.load(std::memory_order_acquire);
+			for (int i = 1; !action && i < count; i++) {
+				action = threads[(self->index + i) % count]->popBack();
+				if (action) {
+					++stolen;
+				}
+			}
+			if (action) {
+				--queued;
+				return action;
+			}
+			std::unique_lock<std::mutex> lock(idleMutex);
+			idle.wait(lock, [this]() { return queued.load() > 0 || !running.load(); });
+		}
+		return nullptr;
+	}
+
+	void logMetrics() {
+		double t = timer_monotonic();
+		double elapsed = t - lastMetricsTime;
+		int count = threadCount.load();
+		int64_t busy = busyNanos.load();
+		TraceEvent("ThreadPoolMetrics")
+		    .detail("Name", name)
+		    .detail("Threads", count)
+		    .detail("Queued", queued.load())
+		    .detail("Executed", executed.load())
+		    .detail("Stolen", stolen.load())
+		    .detail("Utilization", count && elapsed > 0 ? (busy - lastBusyNanos) / (elapsed * 1e9 * count) : 0.0);
+		lastMetricsTime = t;
+		lastBusyNanos = busy;
+	}
+
+public:
+	WorkStealingThreadPool(int stackSize, int pri)
+	  : threadCount(0), nextThread(0), queued(0), running(true), stackSize(stackSize), pri(pri), executed(0),
+	    stolen(0), busyNanos(0), lastMetricsTime(timer_monotonic()), lastBusyNanos(0) {}
+	~WorkStealingThreadPool() override {}
+	Future<Void> stop(Error const& e = success()) override {
+		if (!running)
+			return Void();
+		ReferenceCounted<WorkStealingThreadPool>::addref();
+		{
+			std::lock_guard<std::mutex> lock(idleMutex);
+			running = false;
+		}
+		idle.notify_all();
+		int count = threadCount.load();
+		for (int i = 0; i < count; i++) {
+			waitThread(threads[i]->handle);
+		}
+		for (int i = 0; i < count; i++) {
+			while (PThreadAction action = threads[i]->popFront()) {
+				action->cancel();
+			}
+			delete threads[i];
+		}
+		threadCount = 0;
+		ReferenceCounted<WorkStealingThreadPool>::delref();
+		return Void();
+	}
+
+	Future<Void> getError() const override { return Never(); } // FIXME
+	void addref() override { ReferenceCounted<WorkStealingThreadPool>::addref(); }
+	void delref() override {
+		if (ReferenceCounted<WorkStealingThreadPool>::delref_no_destroy()) {
+			stop();
+			delete this;
+		}
+	}
+	void addThread(IThreadPoolReceiver* userData, const char* threadName) override {
+		int index = threadCount.load();
+		ASSERT(index < MAX_THREADS);
+		if (index == 0 && threadName) {
+			name = threadName;
+		}
+		threads[index] = new Thread(this, index, userData);
+		threadCount.store(index + 1, std::memory_order_release);
+		threads[index]->handle = g_network->startThread(start, threads[index], stackSize, threadName);
+	}
+	void post(PThreadAction action) override {
+		int count = threadCount.load(std::memory_order_acquire);
+		ASSERT(count > 0);
+		Thread* target = threads[nextThread++ % count];
+		int priorityClass = action->getPriority() < TaskPriority::DefaultYield ? Background : Foreground;
+		{
+			std::lock_guard<std::mutex> lock(target->mutex);
+			target->queues[priorityClass].push_back(action);
+		}
+		++queued;
+		{
+			// Taking idleMutex orders the increment of queued before any idle thread's wait predicate
+			std::lock_guard<std::mutex> lock(idleMutex);
+		}
+		idle.notify_one();
+
+		if (g_network->isOnMainThread() &&
+		    timer_monotonic() - lastMetricsTime >= FLOW_KNOBS->THREAD_POOL_METRICS_INTERVAL) {
+			logMetrics();
+		}
+	}
+};
+
+Reference<IThreadPool> createWorkStealingThreadPool(int stackSize, int pri) {
+	return Reference<IThreadPool>(new WorkStealingThreadPool(stackSize, pri));
+}
+
 Reference<IThreadPool> createGenericThreadPool(int stackSize, int pri) {
+	if (FLOW_KNOBS->WORK_STEALING_THREAD_POOL) {
+		return createWorkStealingThreadPool(stackSize, pri);
+	}
 	return Reference<IThreadPool>(new ThreadPool(stackSize, pri));
 }
 
 thread_local IThreadPoolReceiver* ThreadPool::Thread::threadUserObject;
+
+Reference<IThreadPool> getComputeThreadPool() {
+	// Never destroyed, so that compute threads are not joined during static destruction
+	static Reference<IThreadPool>* pool = []() {
+		auto* p = new Reference<IThreadPool>();
+		if (FLOW_KNOBS->COMPUTE_THREADS > 0 && !g_network->isSimulated()) {
+			*p = createGenericThreadPool();
+			for (int i = 0; i < FLOW_KNOBS->COMPUTE_THREADS; ++i) {
+				(*p)->addThread(new ComputeThreadReceiver(), "fdb-compute");
+			}
+		}
+		return p;
+	}();
+	return *pool;
+}
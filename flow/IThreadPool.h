@@ -53,6 +53,9 @@ struct ThreadAction {
 	virtual void operator()(IThreadPoolReceiver*) = 0; // self-destructs
 	virtual void cancel() = 0;
 	virtual double getTimeEstimate() const = 0; // for simulation
+	// Thread pools that order their queues (see WorkStealingThreadPool) run actions with a priority below
+	// TaskPriority::DefaultYield, such as background cleanup, only when no other actions are queued
+	virtual TaskPriority getPriority() const { return TaskPriority::DefaultYield; }
 };
 typedef ThreadAction* PThreadAction;
 
@@ -145,6 +148,61 @@ private:
 
 Reference<IThreadPool> createGenericThreadPool(int stackSize = 0, int pri = 10);
 
+// A pool with a queue per thread, in which idle threads steal queued actions from busy ones. createGenericThreadPool()
+// returns one of these when WORK_STEALING_THREAD_POOL is set.
+Reference<IThreadPool> createWorkStealingThreadPool(int stackSize = 0, int pri = 10);
+
+// Receiver for threads that only run ComputeActions, which need no per-thread state
+struct ComputeThreadReceiver final : IThreadPoolReceiver {
+	void init() override {}
+};
+
+// Returns the process-wide pool of COMPUTE_THREADS threads for CPU-bound work, created on first use. Returns an invalid
+// reference if the knob is 0 or the network is simulated.
+Reference<IThreadPool> getComputeThreadPool();
+
+template <class T>
+struct ComputeAction final : ThreadAction {
+	std::function<T()> fn;
+	ThreadReturnPromise<T> result;
+
+	explicit ComputeAction(std::function<T()>&& fn) : fn(std::move(fn)) {}
+
+	void operator()(IThreadPoolReceiver*) override {
+		try {
+			result.send(fn());
+		} catch (Error& e) {
+			result.sendError(e);
+		} catch (...) {
+			result.sendError(unknown_error());
+		}
+		delete this;
+	}
+	void cancel() override { delete this; }
+	double getTimeEstimate() const override { return 0; }
+};
+
+// Runs fn on a compute thread, letting a single process spread CPU-bound work (hashing, compression, sorting, encoding)
+// over more than one core. The result, or the Error thrown by fn, is delivered to the network thread through its
+// thread-ready queue. fn must not use flow primitives (Futures, Promises, Reference counts shared with the network
+// thread, g_network), and any memory it reads must stay alive and unmodified until the returned future is ready.
+// Without compute threads fn runs inline before this returns. pool defaults to getComputeThreadPool().
+template <class T>
+Future<T> runOnComputeThread(std::function<T()> fn, Reference<IThreadPool> pool = getComputeThreadPool()) {
+	if (!pool) {
+		try {
+			return fn();
+		} catch (Error& e) {
+			return e;
+		}
+	}
+
+	auto* action = new ComputeAction<T>(std::move(fn));
+	Future<T> result = action->result.getFuture();
+	pool->post(action);
+	return result;
+}
+
 class DummyThreadPool final : public IThreadPool, ReferenceCounted<DummyThreadPool> {
 public:
 	~DummyThreadPool() override {}
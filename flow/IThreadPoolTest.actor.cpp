@@ -162,6 +162,144 @@ TEST_CASE("/flow/IThreadPool/ThreadReturnPromiseStream") {
 	return Void();
 }
 
+TEST_CASE("/flow/IThreadPool/ComputeAction") {
+	noUnseed = true;
+
+	state Reference<IThreadPool> pool = createGenericThreadPool();
+	pool->addThread(new ThreadNameReceiver(), "thread-compute");
+
+	auto* sum = new ComputeAction<int64_t>([]() {
+		int64_t s = 0;
+		for (int i = 1; i <= 1000; ++i) {
+			s += i;
+		}
+		return s;
+	});
+	state Future<int64_t> sumFuture = sum->result.getFuture();
+	pool->post(sum);
+	int64_t s = wait(sumFuture);
+	ASSERT(s == 500500);
+
+	auto* faulty = new ComputeAction<int>([]() -> int { throw io_error(); });
+	state Future<int> faultyFuture = faulty->result.getFuture();
+	pool->post(faulty);
+	try {
+		wait(success(faultyFuture));
+		ASSERT(false);
+	} catch (Error& e) {
+		ASSERT(e.code() == error_code_io_error);
+	}
+
+	// Runs inline unless COMPUTE_THREADS is set, and gives the same result either way
+	int inlineResult = wait(runOnComputeThread<int>([]() { return 7; }));
+	ASSERT(inlineResult == 7);
+
+	wait(pool->stop());
+
+	return Void();
+}
+
+TEST_CASE("/flow/IThreadPool/WorkStealing") {
+	noUnseed = true;
+
+	state Reference<IThreadPool> pool = createWorkStealingThreadPool();
+	state int threads = 4;
+	state int i;
+	for (i = 0; i < threads; ++i) {
+		pool->addThread(new ThreadNameReceiver(), "thread-steal");
+	}
+
+	// The first action blocks one thread; actions queued behind it must be stolen by the others to finish
+	state std::shared_ptr<std::atomic<bool>> release = std::make_shared<std::atomic<bool>>(false);
+	auto flag = release;
+	auto* blocker = new ComputeAction<int>([flag]() {
+		while (!flag->load()) {
+			threadSleep(0.001);
+		}
+		return 0;
+	});
+	state Future<int> blocked = blocker->result.getFuture();
+	pool->post(blocker);
+
+	state std::vector<Future<int>> results;
+	for (i = 0; i < 100; ++i) {
+		int n = i;
+		auto* action = new ComputeAction<int>([n]() { return n * n; });
+		results.push_back(action->result.getFuture());
+		pool->post(action);
+	}
+	wait(waitForAll(results));
+	for (i = 0; i < results.size(); ++i) {
+		ASSERT(results[i].get() == i * i);
+	}
+	ASSERT(!blocked.isReady());
+
+	release->store(true);
+	wait(success(blocked));
+	wait(pool->stop());
+
+	return Void();
+}
+
+// Records the order in which actions run
+struct OrderedAction final : ThreadAction {
+	std::shared_ptr<std::vector<int>> order;
+	int id;
+	TaskPriority priority;
+	ThreadReturnPromise<Void> done;
+
+	OrderedAction(std::shared_ptr<std::vector<int>> order, int id, TaskPriority priority)
+	  : order(order), id(id), priority(priority) {}
+
+	void operator()(IThreadPoolReceiver*) override {
+		order->push_back(id);
+		done.send(Void());
+		delete this;
+	}
+	void cancel() override { delete this; }
+	double getTimeEstimate() const override { return 0; }
+	TaskPriority getPriority() const override { return priority; }
+};
+
+TEST_CASE("/flow/IThreadPool/WorkStealingPriority") {
+	noUnseed = true;
+
+	state Reference<IThreadPool> pool = createWorkStealingThreadPool();
+	pool->addThread(new ThreadNameReceiver(), "thread-priority");
+
+	// Keep the only thread busy until every action below is queued
+	state std::shared_ptr<std::atomic<bool>> release = std::make_shared<std::atomic<bool>>(false);
+	auto flag = release;
+	auto* blocker = new ComputeAction<int>([flag]() {
+		while (!flag->load()) {
+			threadSleep(0.001);
+		}
+		return 0;
+	});
+	state Future<int> blocked = blocker->result.getFuture();
+	pool->post(blocker);
+
+	// The order is only written by the pool's thread, and read here after the last action has run
+	state std::shared_ptr<std::vector<int>> order = std::make_shared<std::vector<int>>();
+	state std::vector<Future<Void>> done;
+	state int i;
+	for (i = 0; i < 6; ++i) {
+		// Even actions are background work, odd actions are foreground work
+		auto* action =
+		    new OrderedAction(order, i, i % 2 == 0 ? TaskPriority::LowPriorityRead : TaskPriority::DefaultYield);
+		done.push_back(action->done.getFuture());
+		pool->post(action);
+	}
+
+	release->store(true);
+	wait(success(blocked));
+	wait(waitForAll(done));
+	ASSERT(*order == std::vector<int>({ 1, 3, 5, 0, 2, 4 }));
+	wait(pool->stop());
+
+	return Void();
+}
+
 #else
 void forceLinkIThreadPoolTests() {}
 #endif
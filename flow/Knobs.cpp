@@ -46,6 +46,8 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( DELAY_JITTER_OFFSET,                                 0.9 );
 	init( DELAY_JITTER_RANGE,                                  0.2 );
 	init( BUSY_WAIT_THRESHOLD,                                   0 ); // 1e100 == never sleep
+	init( NETWORK_BUSY_POLL_TIME,                                0 ); // Seconds the run loop polls for events before it sleeps; 0 disables
+	init( NETWORK_BUSY_POLL_PROCESS_CLASSES,                    "" ); // Comma separated process classes that busy poll, or empty for all
 	init( CLIENT_REQUEST_INTERVAL,                             1.0 ); if( randomize && BUGGIFY ) CLIENT_REQUEST_INTERVAL = 2.0;
 	init( SERVER_REQUEST_INTERVAL,                             1.0 ); if( randomize && BUGGIFY ) SERVER_REQUEST_INTERVAL = 2.0;
 
@@ -67,6 +69,8 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( FAST_ALLOC_LOGGING_BYTES,                           10e6 );
 	init( HUGE_ARENA_LOGGING_BYTES,                          100e6 );
 	init( HUGE_ARENA_LOGGING_INTERVAL,                         5.0 );
+	init( ALLOCATION_SAMPLING_BYTES,                       1 << 20 );
+	init( ALLOCATION_SAMPLES_LOGGED,                            20 );
 
 	init( MEMORY_USAGE_CHECK_INTERVAL,                         1.0 );
 
@@ -115,6 +119,11 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( TLS_HANDSHAKE_THREAD_STACKSIZE,                64 * 1024 );
 	init( TLS_MALLOC_ARENA_MAX,                                  6 );
 	init( TLS_HANDSHAKE_LIMIT,                                1000 );
+	init( TLS_WRITE_COALESCE_BYTES,                          16384 ); if( randomize && BUGGIFY ) TLS_WRITE_COALESCE_BYTES = deterministicRandom()->randomInt(0, 16385);
+
+	init( COMPUTE_THREADS,                                       0 ); // 0 runs offloaded work inline
+	init( WORK_STEALING_THREAD_POOL,                         false ); if( randomize && BUGGIFY ) WORK_STEALING_THREAD_POOL = true;
+	init( THREAD_POOL_METRICS_INTERVAL,                        5.0 );
 
 	init( NETWORK_TEST_CLIENT_COUNT,                            30 );
 	init( NETWORK_TEST_REPLY_SIZE,                           600e3 );
@@ -137,6 +146,7 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 		// Choose 16KB to 64KB as I/O size
 		FLOW_CACHEDFILE_WRITE_IO_SIZE = deterministicRandom()->randomInt(16384, 65537);
 	}
+	init( FLOW_CACHEDFILE_MAX_COALESCED_WRITE_BYTES,       1<<20 ); if( randomize && BUGGIFY ) FLOW_CACHEDFILE_MAX_COALESCED_WRITE_BYTES = deterministicRandom()->coinflip() ? 0 : 1<<17;
 
 	//AsyncFileEIO
 	init( EIO_MAX_PARALLELISM,                                  4  );
@@ -184,6 +194,8 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( MAX_PACKET_SEND_BYTES,                        128 * 1024 );
 	init( MIN_PACKET_BUFFER_BYTES,                        4 * 1024 );
 	init( MIN_PACKET_BUFFER_FREE_BYTES,                        256 );
+	init( LARGE_PACKET_BUFFER_BYTES,                     64 * 1024 ); if( randomize && BUGGIFY ) LARGE_PACKET_BUFFER_BYTES = deterministicRandom()->randomInt(1024, 128 * 1024);
+	init( PACKET_COMPRESSION_THRESHOLD,                          0 ); if( randomize && BUGGIFY ) PACKET_COMPRESSION_THRESHOLD = deterministicRandom()->randomInt(64, 65536); // 0 disables compression
 	init( FLOW_TCP_NODELAY,                                      1 );
 	init( FLOW_TCP_QUICKACK,                                     0 );
 
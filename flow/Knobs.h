@@ -119,6 +119,8 @@ public:
 	double DELAY_JITTER_OFFSET;
 	double DELAY_JITTER_RANGE;
 	double BUSY_WAIT_THRESHOLD;
+	double NETWORK_BUSY_POLL_TIME;
+	std::string NETWORK_BUSY_POLL_PROCESS_CLASSES;
 	double CLIENT_REQUEST_INTERVAL;
 	double SERVER_REQUEST_INTERVAL;
 
@@ -129,6 +131,8 @@ public:
 	double FAST_ALLOC_LOGGING_BYTES;
 	double HUGE_ARENA_LOGGING_BYTES;
 	double HUGE_ARENA_LOGGING_INTERVAL;
+	int64_t ALLOCATION_SAMPLING_BYTES; // sampling rate used when allocation profiling is enabled by a ProfilerRequest
+	int ALLOCATION_SAMPLES_LOGGED;
 
 	double MEMORY_USAGE_CHECK_INTERVAL;
 
@@ -183,6 +187,11 @@ public:
 	int TLS_HANDSHAKE_THREAD_STACKSIZE;
 	int TLS_MALLOC_ARENA_MAX;
 	int TLS_HANDSHAKE_LIMIT;
+	int TLS_WRITE_COALESCE_BYTES; // small send buffers are gathered into one TLS record of up to this many bytes
+
+	int COMPUTE_THREADS;
+	bool WORK_STEALING_THREAD_POOL; // createGenericThreadPool() returns a WorkStealingThreadPool
+	double THREAD_POOL_METRICS_INTERVAL;
 
 	int NETWORK_TEST_CLIENT_COUNT;
 	int NETWORK_TEST_REPLY_SIZE;
@@ -204,6 +213,7 @@ public:
 	int TOO_MANY_CONNECTIONS_CLOSED_TIMEOUT;
 	int PEER_UNAVAILABLE_FOR_LONG_TIME_TIMEOUT;
 	int FLOW_CACHEDFILE_WRITE_IO_SIZE;
+	int FLOW_CACHEDFILE_MAX_COALESCED_WRITE_BYTES; // adjacent dirty pages are flushed as one write up to this size
 
 	// AsyncFileEIO
 	int EIO_MAX_PARALLELISM;
@@ -252,6 +262,8 @@ public:
 	int MAX_PACKET_SEND_BYTES;
 	int MIN_PACKET_BUFFER_BYTES;
 	int MIN_PACKET_BUFFER_FREE_BYTES;
+	int LARGE_PACKET_BUFFER_BYTES; // incoming packets at least this large get their own receive buffer
+	int PACKET_COMPRESSION_THRESHOLD; // packets at least this large are compressed for peers that support it
 	int FLOW_TCP_NODELAY;
 	int FLOW_TCP_QUICKACK;
 
@@ -0,0 +1,266 @@
+/*
+ * LZCompression.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flow/LZCompression.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "flow/Error.h"
+#include "flow/IRandom.h"
+#include "flow/UnitTest.h"
+
+namespace LZCompression {
+
+namespace {
+
+constexpr int MIN_MATCH = 4;
+// Matches must end at least this many bytes before the end of the input, so the last token always has literals
+constexpr int LAST_LITERALS = 5;
+constexpr int MAX_OFFSET = 65535;
+constexpr int HASH_BITS = 12;
+constexpr int RUN_MASK = 15;
+
+inline uint32_t hash4(const uint8_t* p) {
+	uint32_t v;
+	memcpy(&v, p, sizeof(v));
+	return (v * 2654435761U) >> (32 - HASH_BITS);
+}
+
+// Writes the part of a length that did not fit in a token nibble
+inline uint8_t* writeLength(uint8_t* op, int length) {
+	while (length >= 255) {
+		*op++ = 255;
+		length -= 255;
+	}
+	*op++ = length;
+	return op;
+}
+
+inline uint8_t* writeLiterals(uint8_t* op, uint8_t* token, const uint8_t* literals, int literalLength) {
+	*token = std::min(literalLength, RUN_MASK) << 4;
+	if (literalLength >= RUN_MASK) {
+		op = writeLength(op, literalLength - RUN_MASK);
+	}
+	memcpy(op, literals, literalLength);
+	return op + literalLength;
+}
+
+// Reads a length whose token nibble was RUN_MASK, adding the continuation bytes that follow
+inline int64_t readLength(const uint8_t*& ip, const uint8_t* iend, int64_t length) {
+	if (length == RUN_MASK) {
+		uint8_t b;
+		do {
+			if (ip >= iend) {
+				throw serialization_failed();
+			}
+			b = *ip++;
+			length += b;
+		} while (b == 255);
+	}
+	return length;
+}
+
+} // namespace
+
+int maxCompressedSize(int inputSize) {
+	return inputSize + inputSize / 255 + 16;
+}
+
+int compress(const uint8_t* src, int srcSize, uint8_t* dst) {
+	const uint8_t* ip = src;
+	const uint8_t* anchor = src;
+	const uint8_t* const end = src + srcSize;
+	const uint8_t* const matchLimit = end - LAST_LITERALS;
+	uint8_t* op = dst;
+
+	if (srcSize > MIN_MATCH + LAST_LITERALS) {
+		int table[1 << HASH_BITS];
+		std::fill(table, table + (1 << HASH_BITS), -1);
+
+		while (ip + MIN_MATCH <= matchLimit) {
+			uint32_t h = hash4(ip);
+			int candidate = table[h];
+			table[h] = ip - src;
+			if (candidate < 0 || ip - (src + candidate) > MAX_OFFSET || memcmp(src + candidate, ip, MIN_MATCH) != 0) {
+				++ip;
+				continue;
+			}
+
+			const uint8_t* match = src + candidate;
+			int matchLength = MIN_MATCH;
+			while (ip + matchLength < matchLimit && match[matchLength] == ip[matchLength]) {
+				++matchLength;
+			}
+
+			uint8_t* token = op++;
+			op = writeLiterals(op, token, anchor, ip - anchor);
+			int offset = ip - match;
+			*op++ = offset & 0xff;
+			*op++ = offset >> 8;
+			int extra = matchLength - MIN_MATCH;
+			*token |= std::min(extra, RUN_MASK);
+			if (extra >= RUN_MASK) {
+				op = writeLength(op, extra - RUN_MASK);
+			}
+
+			ip += matchLength;
+			anchor = ip;
+		}
+	}
+
+	uint8_t* token = op++;
+	op = writeLiterals(op, token, anchor, end - anchor);
+
+	ASSERT(op - dst <= maxCompressedSize(srcSize));
+	return op - dst;
+}
+
+void decompress(const uint8_t* src, int srcSize, uint8_t* dst, int dstSize) {
+	const uint8_t* ip = src;
+	const uint8_t* const iend = src + srcSize;
+	uint8_t* op = dst;
+	uint8_t* const oend = dst + dstSize;
+
+	while (true) {
+		if (ip >= iend) {
+			throw serialization_failed();
+		}
+		uint8_t token = *ip++;
+
+		int64_t literalLength = readLength(ip, iend, token >> 4);
+		if (literalLength > iend - ip || literalLength > oend - op) {
+			throw serialization_failed();
+		}
+		memcpy(op, ip, literalLength);
+		ip += literalLength;
+		op += literalLength;
+
+		if (ip == iend) {
+			break;
+		}
+
+		if (iend - ip < 2) {
+			throw serialization_failed();
+		}
+		int offset = ip[0] | (ip[1] << 8);
+		ip += 2;
+		if (offset == 0 || offset > op - dst) {
+			throw serialization_failed();
+		}
+
+		int64_t matchLength = readLength(ip, iend, token & RUN_MASK) + MIN_MATCH;
+		if (matchLength > oend - op) {
+			throw serialization_failed();
+		}
+		const uint8_t* match = op - offset;
+		if (offset >= matchLength) {
+			memcpy(op, match, matchLength);
+		} else {
+			// Overlapping reference, which repeats the last offset bytes
+			for (int i = 0; i < matchLength; ++i) {
+				op[i] = match[i];
+			}
+		}
+		op += matchLength;
+	}
+
+	if (op != oend) {
+		throw serialization_failed();
+	}
+}
+
+} // namespace LZCompression
+
+// Returns a buffer that mixes random bytes with runs and repeats of earlier content
+static std::string randomCompressibleString(int size) {
+	std::string s;
+	s.reserve(size);
+	while (s.size() < size) {
+		int n = std::min<int>(size - s.size(), deterministicRandom()->randomInt(1, 300));
+		int mode = deterministicRandom()->randomInt(0, 3);
+		if (mode == 0 || s.empty()) {
+			for (int i = 0; i < n; ++i) {
+				s.push_back(deterministicRandom()->randomInt(0, 256));
+			}
+		} else if (mode == 1) {
+			s.append(n, (char)deterministicRandom()->randomInt(0, 256));
+		} else {
+			int from = deterministicRandom()->randomInt(0, s.size());
+			for (int i = 0; i < n; ++i) {
+				s.push_back(s[from + i]);
+			}
+		}
+	}
+	return s;
+}
+
+TEST_CASE("/flow/LZCompression/roundTrip") {
+	for (int i = 0; i < 1000; ++i) {
+		int size = deterministicRandom()->randomInt(0, deterministicRandom()->coinflip() ? 100 : 200000);
+		std::string input = randomCompressibleString(size);
+		std::string compressed(LZCompression::maxCompressedSize(size), '\0');
+		int compressedSize =
+		    LZCompression::compress((const uint8_t*)input.data(), input.size(), (uint8_t*)&compressed[0]);
+		ASSERT(compressedSize <= compressed.size());
+
+		std::string output(size, '\0');
+		LZCompression::decompress((const uint8_t*)compressed.data(), compressedSize, (uint8_t*)&output[0], size);
+		ASSERT(output == input);
+	}
+
+	std::string zeroes(100000, '\0');
+	std::string compressed(LZCompression::maxCompressedSize(zeroes.size()), '\0');
+	int compressedSize =
+	    LZCompression::compress((const uint8_t*)zeroes.data(), zeroes.size(), (uint8_t*)&compressed[0]);
+	ASSERT(compressedSize < 1000);
+
+	return Void();
+}
+
+TEST_CASE("/flow/LZCompression/corruption") {
+	// Damaged blocks must either be rejected or decode to some output of the expected size, never overrun a buffer
+	for (int i = 0; i < 1000; ++i) {
+		int size = deterministicRandom()->randomInt(1, 10000);
+		std::string input = randomCompressibleString(size);
+		std::string compressed(LZCompression::maxCompressedSize(size), '\0');
+		int compressedSize =
+		    LZCompression::compress((const uint8_t*)input.data(), input.size(), (uint8_t*)&compressed[0]);
+		compressed.resize(compressedSize);
+
+		if (deterministicRandom()->coinflip()) {
+			int bit = deterministicRandom()->randomInt(0, 8);
+			compressed[deterministicRandom()->randomInt(0, compressedSize)] ^= 1 << bit;
+		} else {
+			compressed.resize(deterministicRandom()->randomInt(0, compressedSize));
+		}
+
+		std::string output(size, '\0');
+		try {
+			LZCompression::decompress(
+			    (const uint8_t*)compressed.data(), compressed.size(), (uint8_t*)&output[0], output.size());
+		} catch (Error& e) {
+			ASSERT(e.code() == error_code_serialization_failed);
+		}
+	}
+
+	return Void();
+}
@@ -0,0 +1,46 @@
+/*
+ * LZCompression.h
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLOW_LZCOMPRESSION_H
+#define FLOW_LZCOMPRESSION_H
+#pragma once
+
+#include <cstdint>
+
+// A small LZ77 block codec in the style of LZ4, for places that want cheap compression of serialized data without
+// depending on an external library. The compressed block is a sequence of tokens, each giving the length of a run of
+// literal bytes that follows it and the length of a back reference (at most 64KB back) that follows the literals. The
+// final token has only literals. Blocks are not self-describing, so callers must record the uncompressed size.
+namespace LZCompression {
+
+// Upper bound on the compressed size of an input of the given size
+int maxCompressedSize(int inputSize);
+
+// Compresses [src, src + srcSize) into dst, which must have room for maxCompressedSize(srcSize) bytes. Returns the
+// number of bytes written to dst.
+int compress(const uint8_t* src, int srcSize, uint8_t* dst);
+
+// Decompresses a block produced by compress() into exactly dstSize bytes at dst. Throws serialization_failed() if the
+// block is malformed or does not decompress to exactly dstSize bytes.
+void decompress(const uint8_t* src, int srcSize, uint8_t* dst, int dstSize);
+
+} // namespace LZCompression
+
+#endif
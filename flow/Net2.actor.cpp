@@ -37,6 +37,7 @@
 
 #include "flow/ActorCollection.h"
 #include "flow/ThreadSafeQueue.h"
+#include "flow/TimingWheel.h"
 #include "flow/ThreadHelper.actor.h"
 #include "flow/TDMetric.actor.h"
 #include "flow/AsioReactor.h"
@@ -270,13 +271,9 @@ public:
 	ReadyQueue<OrderedTask> ready;
 	ThreadSafeQueue<OrderedTask> threadReady;
 
-	struct DelayedTask : OrderedTask {
-		double at;
-		DelayedTask(double at, int64_t priority, TaskPriority taskID, Task* task)
-		  : OrderedTask(priority, taskID, task), at(at) {}
-		bool operator<(DelayedTask const& rhs) const { return at > rhs.at; } // Ordering is reversed for priority_queue
-	};
-	std::priority_queue<DelayedTask, std::vector<DelayedTask>> timers;
+	// Pending delay()s, as DelayTasks. A DelayTask whose future is dropped unlinks itself, so cancelled timeouts don't
+	// stay queued until they expire.
+	TimingWheel timers;
 
 	void checkForSlowTask(int64_t tscBegin, int64_t tscEnd, double duration, TaskPriority priority);
 	bool check_yield(TaskPriority taskId, int64_t tscNow);
@@ -290,8 +287,7 @@ public:
 		stopped = true;
 		decltype(ready) _1;
 		ready.swap(_1);
-		decltype(timers) _2;
-		timers.swap(_2);
+		timers.clear();
 	}
 
 	Future<Void> timeOffsetLogger;
@@ -316,11 +312,14 @@ public:
 	Int64MetricHandle countYieldCalls;
 	Int64MetricHandle countYieldCallsTrue;
 	Int64MetricHandle countASIOEvents;
+	Int64MetricHandle countSpinWakeups;
 	Int64MetricHandle countRunLoopProfilingSignals;
 	Int64MetricHandle countTLSPolicyFailures;
 	Int64MetricHandle priorityMetric;
 	DoubleMetricHandle countLaunchTime;
 	DoubleMetricHandle countReactTime;
+	DoubleMetricHandle countSpinTime;
+	DoubleMetricHandle countSleepTime;
 	BoolMetricHandle awakeMetric;
 
 	EventMetricHandle<SlowTask> slowTaskMetric;
@@ -329,6 +328,23 @@ public:
 	std::vector<std::function<void()>> stopCallbacks;
 };
 
+// When the run loop busy polls, ask the kernel to busy poll the device queue for this socket too, so that a packet
+// can be picked up by the spinning thread without waiting for the interrupt to be handled
+static void setBusyPoll(tcp::socket& socket) {
+#if defined(__linux__) && defined(SO_BUSY_POLL)
+	if (FLOW_KNOBS->NETWORK_BUSY_POLL_TIME > 0) {
+		boost::system::error_code error;
+		socket.set_option(boost::asio::detail::socket_option::integer<SOL_SOCKET, SO_BUSY_POLL>(
+		                      int(FLOW_KNOBS->NETWORK_BUSY_POLL_TIME * 1e6)),
+		                  error);
+		// Setting SO_BUSY_POLL needs CAP_NET_ADMIN on older kernels; the run loop still spins without it
+		if (error) {
+			TraceEvent(SevWarnAlways, "N2_BusyPollError").suppressFor(60.0).detail("Message", error.message());
+		}
+	}
+#endif
+}
+
 static boost::asio::ip::address tcpAddress(IPAddress const& n) {
 	if (n.isV6()) {
 		return boost::asio::ip::address_v6(n.toV6());
@@ -532,6 +548,7 @@ private:
 			TraceEvent(SevWarn, "N2_InitWarn").detail("Message", "TCP_QUICKACK not supported");
 #endif
 		}
+		setBusyPoll(socket);
 		platform::setCloseOnExec(socket.native_handle());
 	}
 
@@ -1071,8 +1088,24 @@ public:
 		boost::system::error_code err;
 		++g_net2->countWrites;
 
-		size_t sent = ssl_sock.write_some(
-		    boost::iterator_range<SendBufferIterator>(SendBufferIterator(data, limit), SendBufferIterator()), err);
+		// The SSL stream only hands the first buffer of a sequence to SSL_write, so a chain of small SendBuffers would
+		// go out as one small TLS record per write. Gather them into a single buffer of up to a full record instead.
+		size_t sent;
+		int coalesceBytes = std::min(limit, FLOW_KNOBS->TLS_WRITE_COALESCE_BYTES);
+		if (data->next && data->bytes_unsent() < coalesceBytes) {
+			static thread_local std::vector<uint8_t> coalesced;
+			coalesced.resize(coalesceBytes);
+			int len = 0;
+			for (auto p = data; p && len < coalesceBytes; p = p->next) {
+				int n = std::min(p->bytes_unsent(), coalesceBytes - len);
+				memcpy(coalesced.data() + len, p->data() + p->bytes_sent, n);
+				len += n;
+			}
+			sent = ssl_sock.write_some(boost::asio::buffer(coalesced.data(), len), err);
+		} else {
+			sent = ssl_sock.write_some(
+			    boost::iterator_range<SendBufferIterator>(SendBufferIterator(data, limit), SendBufferIterator()), err);
+		}
 
 		if (err) {
 			// Since there was an error, sent's value can't be used to infer that the buffer has data and the limit is
@@ -1118,6 +1151,7 @@ private:
 		// Socket settings that have to be set after connect or accept succeeds
 		socket.non_blocking(true);
 		socket.set_option(boost::asio::ip::tcp::no_delay(true));
+		setBusyPoll(socket);
 		platform::setCloseOnExec(socket.native_handle());
 	}
 
@@ -1203,6 +1237,32 @@ struct PromiseTask final : public Task, public FastAllocated<PromiseTask> {
 	}
 };
 
+// The task behind a delay(). Its SAV is the delay's future, so when the last reference to that future is dropped
+// before the timer expires, cancel() unlinks the task from the timing wheel and frees it.
+struct DelayTask final : public Task, public TimingWheelNode, public SAV<Void>, public FastAllocated<DelayTask> {
+	using FastAllocated<DelayTask>::operator new;
+	using FastAllocated<DelayTask>::operator delete;
+
+	int64_t priority;
+	TaskPriority taskID;
+
+	DelayTask(double at, int64_t priority, TaskPriority taskID)
+	  : TimingWheelNode(at), SAV<Void>(1, 1), priority(priority), taskID(taskID) {}
+
+	void operator()() override {
+		send(Void());
+		delPromiseRef();
+	}
+	void cancel() override {
+		// Once expired, the task is in the ready queue and runs (harmlessly) instead
+		if (linked()) {
+			unlink();
+			delPromiseRef();
+		}
+	}
+	void destroy() override { delete this; }
+};
+
 // 5MB for loading files into memory
 
 Net2::Net2(const TLSConfig& tlsConfig, bool useThreadPool, bool useMetrics)
@@ -1406,6 +1466,7 @@ void Net2::initMetrics() {
 	countYieldBigStack.init(LiteralStringRef("Net2.CountYieldBigStack"));
 	countYieldCalls.init(LiteralStringRef("Net2.CountYieldCalls"));
 	countASIOEvents.init(LiteralStringRef("Net2.CountASIOEvents"));
+	countSpinWakeups.init(LiteralStringRef("Net2.CountSpinWakeups"));
 	countYieldCallsTrue.init(LiteralStringRef("Net2.CountYieldCallsTrue"));
 	countRunLoopProfilingSignals.init(LiteralStringRef("Net2.CountRunLoopProfilingSignals"));
 	countTLSPolicyFailures.init(LiteralStringRef("Net2.CountTLSPolicyFailures"));
@@ -1414,6 +1475,8 @@ void Net2::initMetrics() {
 	slowTaskMetric.init(LiteralStringRef("Net2.SlowTask"));
 	countLaunchTime.init(LiteralStringRef("Net2.CountLaunchTime"));
 	countReactTime.init(LiteralStringRef("Net2.CountReactTime"));
+	countSpinTime.init(LiteralStringRef("Net2.CountSpinTime"));
+	countSleepTime.init(LiteralStringRef("Net2.CountSleepTime"));
 }
 
 bool Net2::checkRunnable() {
@@ -1479,9 +1542,7 @@ void Net2::run() {
 		if (b) {
 			sleepTime = 1e99;
 			double sleepStart = timer_monotonic();
-			if (!timers.empty()) {
-				sleepTime = timers.top().at - sleepStart; // + 500e-6?
-			}
+			sleepTime = std::min(sleepTime, timers.nextExpiration() - sleepStart); // + 500e-6?
 			if (sleepTime > 0) {
 #if defined(__linux__)
 				// notify the run loop monitoring thread that we have gone idle
@@ -1513,12 +1574,12 @@ void Net2::run() {
 			TraceEvent("SomewhatSlowRunLoopTop").detail("Elapsed", now - nnow);
 
 		int numTimers = 0;
-		while (!timers.empty() && timers.top().at < now) {
+		timers.advance(now, [&](TimingWheelNode* node) {
+			DelayTask* t = static_cast<DelayTask*>(node);
 			++numTimers;
 			++countTimers;
-			ready.push(timers.top());
-			timers.pop();
-		}
+			ready.push(OrderedTask(t->priority, t->taskID, t));
+		});
 		// FIXME: Is this double counting?
 		countTimers += numTimers;
 		FDB_TRACE_PROBE(run_loop_ready_timers, numTimers);
@@ -1797,9 +1858,9 @@ Future<Void> Net2::delay(double seconds, TaskPriority taskId) {
 		return Never();
 
 	double at = now() + seconds;
-	PromiseTask* t = new PromiseTask;
-	this->timers.push(DelayedTask(at, (int64_t(taskId) << 32) - (++tasksIssued), taskId, t));
-	return t->promise.getFuture();
+	DelayTask* t = new DelayTask(at, (int64_t(taskId) << 32) - (++tasksIssued), taskId);
+	this->timers.insert(t, now());
+	return Future<Void>(static_cast<SAV<Void>*>(t));
 }
 
 Future<Void> Net2::orderedDelay(double seconds, TaskPriority taskId) {
@@ -2013,7 +2074,8 @@ void Net2::getDiskBytes(std::string const& directory, int64_t& free, int64_t& to
 #include <sched.h>
 #endif
 
-ASIOReactor::ASIOReactor(Net2* net) : do_not_stop(ios), network(net), firstTimer(ios) {
+ASIOReactor::ASIOReactor(Net2* net)
+  : do_not_stop(ios), network(net), firstTimer(ios), spinBudget(FLOW_KNOBS->NETWORK_BUSY_POLL_TIME) {
 #ifdef __linux__
 	// Reactor flags are used only for experimentation, and are platform-specific
 	if (FLOW_KNOBS->REACTOR_FLAGS & 1) {
@@ -2036,7 +2098,15 @@ ASIOReactor::ASIOReactor(Net2* net) : do_not_stop(ios), network(net), firstTimer
 }
 
 void ASIOReactor::sleep(double sleepTime) {
+	if (spinBudget > 0) {
+		double spinTime = std::min(spinBudget, sleepTime);
+		if (spin(spinTime)) {
+			return;
+		}
+		sleepTime -= spinTime;
+	}
 	if (sleepTime > FLOW_KNOBS->BUSY_WAIT_THRESHOLD) {
+		double sleepStart = timer_monotonic();
 		if (FLOW_KNOBS->REACTOR_FLAGS & 4) {
 #ifdef __linux
 			timespec tv;
@@ -2055,6 +2125,7 @@ void ASIOReactor::sleep(double sleepTime) {
 			setProfilingEnabled(1);
 			this->firstTimer.cancel();
 		}
+		network->countSleepTime += timer_monotonic() - sleepStart;
 		++network->countASIOEvents;
 	} else if (sleepTime > 0) {
 		if (!(FLOW_KNOBS->REACTOR_FLAGS & 8))
@@ -2062,6 +2133,31 @@ void ASIOReactor::sleep(double sleepTime) {
 	}
 }
 
+// Polls for events without blocking for up to spinTime seconds, and returns true if one arrived. The spin budget
+// adapts to the load: it goes back to NETWORK_BUSY_POLL_TIME whenever spinning catches an event and halves, down to a
+// sixteenth of the knob, each time it does not, so a mostly idle process does not keep a core busy.
+bool ASIOReactor::spin(double spinTime) {
+	double spinStart = timer_monotonic();
+	double spinEnd = spinStart + spinTime;
+	bool woken = false;
+	do {
+		if (ios.poll_one()) {
+			++network->countASIOEvents;
+			woken = true;
+			break;
+		}
+	} while (timer_monotonic() < spinEnd);
+	network->countSpinTime += timer_monotonic() - spinStart;
+
+	if (woken) {
+		++network->countSpinWakeups;
+		spinBudget = FLOW_KNOBS->NETWORK_BUSY_POLL_TIME;
+	} else {
+		spinBudget = std::max(spinBudget / 2, FLOW_KNOBS->NETWORK_BUSY_POLL_TIME / 16);
+	}
+	return woken;
+}
+
 void ASIOReactor::react() {
 	while (ios.poll_one())
 		++network->countASIOEvents; // Make this a task?
@@ -162,6 +162,7 @@ SystemStatistics customSystemMonitor(std::string const& eventName, StatisticsSta
 			    .DETAILALLOCATORMEMUSAGE(8192)
 			    .DETAILALLOCATORMEMUSAGE(16384)
 			    .detail("HugeArenaMemory", g_hugeArenaMemory.load())
+			    .detail("CachedArenaBlockMemory", g_cachedArenaBlockMemory.load())
 			    .detail("DCID", machineState.dcId)
 			    .detail("ZoneID", machineState.zoneId)
 			    .detail("MachineID", machineState.machineId);
@@ -225,6 +226,9 @@ SystemStatistics customSystemMonitor(std::string const& eventName, StatisticsSta
 			    .detail("WouldBlock", netData.countWouldBlock - statState->networkState.countWouldBlock)
 			    .detail("LaunchTime", netData.countLaunchTime - statState->networkState.countLaunchTime)
 			    .detail("ReactTime", netData.countReactTime - statState->networkState.countReactTime)
+			    .detail("SpinTime", netData.countSpinTime - statState->networkState.countSpinTime)
+			    .detail("SleepTime", netData.countSleepTime - statState->networkState.countSleepTime)
+			    .detail("SpinWakeups", netData.countSpinWakeups - statState->networkState.countSpinWakeups)
 			    .detail("DCID", machineState.dcId)
 			    .detail("ZoneID", machineState.zoneId)
 			    .detail("MachineID", machineState.machineId);
@@ -68,6 +68,7 @@ struct NetworkData {
 	int64_t countYieldBigStack;
 	int64_t countYieldCalls;
 	int64_t countASIOEvents;
+	int64_t countSpinWakeups;
 	int64_t countYieldCallsTrue;
 	int64_t countRunLoopProfilingSignals;
 	int64_t countFileLogicalWrites;
@@ -90,6 +91,8 @@ struct NetworkData {
 	int64_t countTLSPolicyFailures;
 	double countLaunchTime;
 	double countReactTime;
+	double countSpinTime;
+	double countSleepTime;
 
 	void init() {
 		bytesSent = Int64Metric::getValueOrDefault(LiteralStringRef("Net2.BytesSent"));
@@ -110,6 +113,7 @@ struct NetworkData {
 		countYieldBigStack = Int64Metric::getValueOrDefault(LiteralStringRef("Net2.CountYieldBigStack"));
 		countYieldCalls = Int64Metric::getValueOrDefault(LiteralStringRef("Net2.CountYieldCalls"));
 		countASIOEvents = Int64Metric::getValueOrDefault(LiteralStringRef("Net2.CountASIOEvents"));
+		countSpinWakeups = Int64Metric::getValueOrDefault(LiteralStringRef("Net2.CountSpinWakeups"));
 		countYieldCallsTrue = Int64Metric::getValueOrDefault(LiteralStringRef("Net2.CountYieldCallsTrue"));
 		countRunLoopProfilingSignals =
 		    Int64Metric::getValueOrDefault(LiteralStringRef("Net2.CountRunLoopProfilingSignals"));
@@ -120,6 +124,8 @@ struct NetworkData {
 		countTLSPolicyFailures = Int64Metric::getValueOrDefault(LiteralStringRef("Net2.CountTLSPolicyFailures"));
 		countLaunchTime = DoubleMetric::getValueOrDefault(LiteralStringRef("Net2.CountLaunchTime"));
 		countReactTime = DoubleMetric::getValueOrDefault(LiteralStringRef("Net2.CountReactTime"));
+		countSpinTime = DoubleMetric::getValueOrDefault(LiteralStringRef("Net2.CountSpinTime"));
+		countSleepTime = DoubleMetric::getValueOrDefault(LiteralStringRef("Net2.CountSleepTime"));
 		countFileLogicalWrites = Int64Metric::getValueOrDefault(LiteralStringRef("AsyncFile.CountLogicalWrites"));
 		countFileLogicalReads = Int64Metric::getValueOrDefault(LiteralStringRef("AsyncFile.CountLogicalReads"));
 		countAIOSubmit = Int64Metric::getValueOrDefault(LiteralStringRef("AsyncFile.CountAIOSubmit"));
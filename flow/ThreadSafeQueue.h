@@ -38,6 +38,8 @@ interpreted as representing official policies, either expressed or implied, of D
 
 #include <atomic>
 
+#include "flow/ThreadPrimitives.h"
+
 #if VALGRIND
 #include <drd.h>
 #endif
@@ -54,8 +56,11 @@ class ThreadSafeQueue : NonCopyable {
 		Node(T const& data) : data(data) {}
 		Node(T&& data) : data(std::move(data)) {}
 	};
-	std::atomic<BaseNode*> head;
-	BaseNode* tail;
+	// head is written by every producer, while the remaining members are mostly touched only by the consumer. Keeping
+	// them on separate cache lines stops each push() from invalidating the consumer's line, which dominates the cost of
+	// the queue when many threads push to it at once.
+	alignas(MAX_CACHE_LINE_SIZE) std::atomic<BaseNode*> head;
+	alignas(MAX_CACHE_LINE_SIZE) BaseNode* tail;
 	BaseNode stub, sleeping;
 	bool sleepy;
 
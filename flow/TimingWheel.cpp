@@ -0,0 +1,73 @@
+/*
+ * TimingWheel.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flow/TimingWheel.h"
+#include "flow/UnitTest.h"
+
+namespace {
+struct TestTimer : TimingWheelNode {
+	bool expired = false;
+};
+} // namespace
+
+TEST_CASE("/flow/TimingWheel/expiration") {
+	TimingWheel wheel;
+	std::vector<TestTimer> timers(2000);
+	double now = 1000 + deterministicRandom()->random01() * 1e6;
+	for (auto& t : timers) {
+		// Mostly short timeouts, with some that land in every level of the wheel and in the overflow list
+		double span = deterministicRandom()->randomChoice(std::vector<double>{ 0.1, 10, 1000, 1e5, 1e8 });
+		t.at = now + deterministicRandom()->random01() * span;
+		wheel.insert(&t, now);
+	}
+	for (int i = 0; i < timers.size(); i += 3) {
+		timers[i].unlink();
+	}
+
+	int expiredCount = 0;
+	while (true) {
+		double next = wheel.nextExpiration();
+		if (next >= 1e99) {
+			break;
+		}
+		// The wheel never reports a wakeup later than a pending timer
+		for (auto& t : timers) {
+			ASSERT(!t.linked() || t.at >= next);
+		}
+		now = std::max(now, next) + deterministicRandom()->random01() * 1e-3;
+		wheel.advance(now, [&](TimingWheelNode* node) {
+			TestTimer* t = static_cast<TestTimer*>(node);
+			ASSERT(t->at < now);
+			t->expired = true;
+			++expiredCount;
+		});
+		// ... and expires every timer that is due
+		for (auto& t : timers) {
+			ASSERT(!t.linked() || t.at >= now);
+		}
+	}
+	for (int i = 0; i < timers.size(); ++i) {
+		ASSERT(timers[i].expired == (i % 3 != 0));
+	}
+	ASSERT(expiredCount == timers.size() - (timers.size() + 2) / 3);
+	return Void();
+}
+
+void forceLinkTimingWheelTests() {}
@@ -0,0 +1,260 @@
+/*
+ * TimingWheel.h
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLOW_TIMINGWHEEL_H
+#define FLOW_TIMINGWHEEL_H
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include "flow/Platform.h"
+
+// A timer in a TimingWheel. Nodes are linked intrusively, so a node can remove itself with unlink() in O(1) without a
+// reference to the wheel it is in.
+struct TimingWheelNode {
+	TimingWheelNode* prev = nullptr;
+	TimingWheelNode* next = nullptr;
+	double at;
+
+	explicit TimingWheelNode(double at = 0) : at(at) {}
+	bool linked() const { return next != nullptr; }
+	void unlink() {
+		prev->next = next;
+		next->prev = prev;
+		prev = next = nullptr;
+	}
+};
+
+// A hierarchical timing wheel: LEVELS wheels of SLOTS slots each, where a slot of level l covers SLOTS^l ticks of
+// TICK seconds. A timer goes into the lowest level whose current rotation contains its tick, and is moved down a level
+// each time the level below wraps around to the timer's slot. Insertion and removal are O(1); advancing costs O(1)
+// per expired timer plus one cascade per occupied higher-level slot. Timers beyond the highest level are kept on an
+// overflow list that is redistributed when the highest level wraps.
+//
+// Timers never expire early: a timer expires on the first advance() whose time is strictly after its at.
+class TimingWheel {
+public:
+	static constexpr double TICK = 1e-3;
+	static constexpr int SLOT_BITS = 8;
+	static constexpr int SLOTS = 1 << SLOT_BITS;
+	static constexpr int LEVELS = 4;
+
+	TimingWheel() {
+		for (auto& level : slots) {
+			for (auto& head : level) {
+				head.prev = head.next = &head;
+			}
+		}
+		overflow.prev = overflow.next = &overflow;
+		std::fill(&occupied[0][0], &occupied[0][0] + LEVELS * WORDS, 0);
+	}
+	~TimingWheel() { clear(); }
+	TimingWheel(const TimingWheel&) = delete;
+	TimingWheel& operator=(const TimingWheel&) = delete;
+
+	// Adds node, which must not already be in a wheel. now is only used to start the wheel's clock on first use.
+	void insert(TimingWheelNode* node, double now) {
+		start(now);
+		place(node);
+	}
+
+	// Removes every timer with at < now, passing each to expire
+	template <class F>
+	void advance(double now, F&& expire) {
+		start(now);
+		int64_t target = std::max(toTick(now), currentTick);
+		expireSlot(currentTick & MASK, now, expire);
+		while (currentTick < target) {
+			// Skip straight to the next tick that has timers to expire or cascade
+			int next = nextOccupied(0, (currentTick & MASK) + 1);
+			int64_t candidate = next < SLOTS ? (currentTick & ~int64_t(MASK)) + next : nextCascade();
+			if (candidate > target) {
+				currentTick = target;
+				break;
+			}
+			currentTick = candidate;
+			if ((currentTick & MASK) == 0) {
+				cascade();
+			}
+			expireSlot(currentTick & MASK, now, expire);
+		}
+	}
+
+	// Returns the earliest time at which advance() might expire a timer: the earliest at in the current rotation of
+	// the lowest level, or else the start of the next occupied slot of a higher level. Returns 1e99 if the wheel is
+	// empty.
+	double nextExpiration() {
+		int slot = nextOccupied(0, currentTick & MASK);
+		if (slot < SLOTS) {
+			double earliest = 1e99;
+			for (TimingWheelNode* n = slots[0][slot].next; n != &slots[0][slot]; n = n->next) {
+				earliest = std::min(earliest, n->at);
+			}
+			return earliest;
+		}
+		int64_t tick = nextCascade();
+		return tick == std::numeric_limits<int64_t>::max() ? 1e99 : tick * TICK;
+	}
+
+	// Unlinks every timer without expiring it
+	void clear() {
+		for (auto& level : slots) {
+			for (auto& head : level) {
+				unlinkAll(head);
+			}
+		}
+		unlinkAll(overflow);
+		std::fill(&occupied[0][0], &occupied[0][0] + LEVELS * WORDS, 0);
+	}
+
+private:
+	static constexpr int MASK = SLOTS - 1;
+	static constexpr int WORDS = SLOTS / 64;
+
+	TimingWheelNode slots[LEVELS][SLOTS];
+	TimingWheelNode overflow;
+	// A set bit means the slot may be nonempty. Nodes unlink themselves without clearing bits, so bits are cleared
+	// lazily when an empty slot is found.
+	uint64_t occupied[LEVELS][WORDS];
+	int64_t currentTick = 0;
+	bool started = false;
+
+	static int64_t toTick(double t) { return int64_t(t / TICK); }
+
+	void start(double now) {
+		if (!started) {
+			currentTick = toTick(now);
+			started = true;
+		}
+	}
+
+	static void linkBefore(TimingWheelNode& head, TimingWheelNode* node) {
+		node->next = &head;
+		node->prev = head.prev;
+		head.prev->next = node;
+		head.prev = node;
+	}
+
+	static void unlinkAll(TimingWheelNode& head) {
+		while (head.next != &head) {
+			head.next->unlink();
+		}
+	}
+
+	void place(TimingWheelNode* node) {
+		int64_t tick = std::max(toTick(node->at), currentTick);
+		for (int level = 0; level < LEVELS; ++level) {
+			int shift = SLOT_BITS * level;
+			if ((tick >> (shift + SLOT_BITS)) == (currentTick >> (shift + SLOT_BITS))) {
+				int slot = (tick >> shift) & MASK;
+				linkBefore(slots[level][slot], node);
+				occupied[level][slot / 64] |= uint64_t(1) << (slot % 64);
+				return;
+			}
+		}
+		linkBefore(overflow, node);
+	}
+
+	// Returns the first tick after currentTick at which cascade() has timers to move down: the start of the next
+	// occupied slot of any level above the lowest, or the next wrap of the highest level if only the overflow list has
+	// timers. Returns the maximum int64_t if there are none.
+	int64_t nextCascade() {
+		for (int level = 1; level < LEVELS; ++level) {
+			int shift = SLOT_BITS * level;
+			int slot = nextOccupied(level, ((currentTick >> shift) & MASK) + 1);
+			if (slot < SLOTS) {
+				int64_t rotation = (currentTick >> (shift + SLOT_BITS)) << (shift + SLOT_BITS);
+				return rotation + (int64_t(slot) << shift);
+			}
+		}
+		if (overflow.next != &overflow) {
+			int shift = SLOT_BITS * LEVELS;
+			return ((currentTick >> shift) + 1) << shift;
+		}
+		return std::numeric_limits<int64_t>::max();
+	}
+
+	// Returns the first slot at or after from in level that has timers, or SLOTS if there is none
+	int nextOccupied(int level, int from) {
+		for (int word = from / 64; word < WORDS; ++word) {
+			uint64_t bits = occupied[level][word];
+			if (word == from / 64) {
+				bits &= ~uint64_t(0) << (from % 64);
+			}
+			while (bits) {
+				int slot = word * 64 + ctzll(bits);
+				if (slots[level][slot].next != &slots[level][slot]) {
+					return slot;
+				}
+				occupied[level][word] &= ~(uint64_t(1) << (slot % 64));
+				bits &= bits - 1;
+			}
+		}
+		return SLOTS;
+	}
+
+	template <class F>
+	void expireSlot(int slot, double now, F& expire) {
+		TimingWheelNode& head = slots[0][slot];
+		for (TimingWheelNode* n = head.next; n != &head;) {
+			TimingWheelNode* next = n->next;
+			if (n->at < now) {
+				n->unlink();
+				expire(n);
+			}
+			n = next;
+		}
+	}
+
+	// Called when currentTick reaches the start of a lowest-level rotation: redistributes the timers of every level
+	// whose slot starts at currentTick. Slots of lower levels that advance() skipped over were empty.
+	void cascade() {
+		TimingWheelNode pending;
+		pending.prev = pending.next = &pending;
+		int level = 1;
+		for (; level < LEVELS; ++level) {
+			int slot = (currentTick >> (SLOT_BITS * level)) & MASK;
+			moveAll(slots[level][slot], pending);
+			if (slot != 0) {
+				break;
+			}
+		}
+		if (level == LEVELS) {
+			moveAll(overflow, pending);
+		}
+		while (pending.next != &pending) {
+			TimingWheelNode* n = pending.next;
+			n->unlink();
+			place(n);
+		}
+	}
+
+	static void moveAll(TimingWheelNode& from, TimingWheelNode& to) {
+		while (from.next != &from) {
+			TimingWheelNode* n = from.next;
+			n->unlink();
+			linkBefore(to, n);
+		}
+	}
+};
+
+#endif
@@ -385,7 +385,16 @@ constexpr bool expect_serialize_member =
 template <class T>
 constexpr bool use_indirection = !(is_scalar<T> || is_struct_like<T>);
 
-using VTable = std::vector<uint16_t>;
+// A vtable is laid out at compile time (see generate_vtable) and lives in static storage, so a VTable is only a view of
+// it.
+struct VTable {
+	const uint16_t* data;
+	size_t length;
+	constexpr size_t size() const { return length; }
+	constexpr const uint16_t& operator[](size_t i) const { return data[i]; }
+	constexpr const uint16_t* begin() const { return data; }
+	constexpr const uint16_t* end() const { return data + length; }
+};
 
 template <class T>
 constexpr int fb_scalar_size = is_scalar<T> ? scalar_traits<T>::size : sizeof(RelativeOffset);
@@ -645,22 +654,66 @@ using Fields = decltype(fields_helper<Member>());
 
 // First |numMembers| elements of sizesAndAlignments are sizes, the second
 // |numMembers| elements are alignments.
-extern VTable generate_vtable(size_t numMembers, const std::vector<unsigned>& sizesAndAlignments);
+template <size_t numMembers>
+constexpr std::array<uint16_t, numMembers + 2> generate_vtable(
+    const std::array<unsigned, 2 * numMembers>& sizesAlignments) {
+	std::array<uint16_t, numMembers + 2> result{};
+	if constexpr (numMembers == 0) {
+		result[0] = 4;
+		result[1] = 4;
+		return result;
+	} else {
+		// Indices of the members with nonzero size, stable sorted by decreasing size
+		std::array<unsigned, numMembers> indexed{};
+		size_t count = 0;
+		for (unsigned i = 0; i < numMembers; ++i) {
+			if (sizesAlignments[i] > 0) {
+				size_t j = count++;
+				while (j > 0 && sizesAlignments[indexed[j - 1]] < sizesAlignments[i]) {
+					indexed[j] = indexed[j - 1];
+					--j;
+				}
+				indexed[j] = i;
+			}
+		}
+		// size of the vtable is
+		// - 2 bytes per member +
+		// - 2 bytes for the size entry +
+		// - 2 bytes for the size of the object
+		result[0] = 2 * numMembers + 4;
+		unsigned offset = 0;
+		for (size_t k = 0; k < count; ++k) {
+			unsigned member = indexed[k];
+			unsigned align = sizesAlignments[numMembers + member];
+			unsigned res = offset % align == 0 ? offset : ((offset / align) + 1) * align;
+			offset = res + sizesAlignments[member];
+			result[member + 2] = res + 4;
+		}
+		result[1] = offset + 4;
+		return result;
+	}
+}
+
+template <unsigned... MembersAndAlignments>
+struct VTableStorage {
+	static constexpr size_t numMembers = sizeof...(MembersAndAlignments) / 2;
+	static constexpr std::array<uint16_t, numMembers + 2> data =
+	    generate_vtable<numMembers>(std::array<unsigned, 2 * numMembers>{ MembersAndAlignments... });
+	static constexpr VTable table{ data.data(), data.size() };
+};
 
 template <unsigned... MembersAndAlignments>
-const VTable* gen_vtable3() {
-	static thread_local VTable table =
-	    generate_vtable(sizeof...(MembersAndAlignments) / 2, std::vector<unsigned>{ MembersAndAlignments... });
-	return &table;
+constexpr const VTable* gen_vtable3() {
+	return &VTableStorage<MembersAndAlignments...>::table;
 }
 
 template <class... Members>
-const VTable* gen_vtable2(pack<Members...> p) {
+constexpr const VTable* gen_vtable2(pack<Members...> p) {
 	return gen_vtable3<_SizeOf<Members>::size..., _SizeOf<Members>::align...>();
 }
 
 template <class... Members>
-const VTable* get_vtable() {
+constexpr const VTable* get_vtable() {
 	return gen_vtable2(concat_t<Fields<Members>...>{});
 }
 
@@ -746,7 +799,7 @@ struct InsertVTableLambda : Context {
 
 template <class T>
 int vec_bytes(const T& begin, const T& end) {
-	return sizeof(typename T::value_type) * (end - begin);
+	return sizeof(typename std::iterator_traits<T>::value_type) * (end - begin);
 }
 
 template <class Root, class Context>
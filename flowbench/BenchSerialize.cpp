@@ -0,0 +1,87 @@
+/*
+ * BenchSerialize.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark/benchmark.h"
+#include "fdbclient/StorageServerInterface.h"
+#include "flow/ObjectSerializer.h"
+#include "flowbench/GlobalData.h"
+
+// A message with the shape of the small fixed-layout requests and replies on the hot path: a few scalars and a key
+struct FixedShapeMessage {
+	constexpr static FileIdentifier file_identifier = 13487252;
+	Version version = 0;
+	int64_t bytes = 0;
+	int32_t flags = 0;
+	bool cached = false;
+	Key key;
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, version, bytes, flags, cached, key);
+	}
+};
+
+template <class Message>
+Message makeMessage(size_t keySize);
+
+template <>
+FixedShapeMessage makeMessage<FixedShapeMessage>(size_t keySize) {
+	FixedShapeMessage m;
+	m.version = 123456789;
+	m.bytes = 4096;
+	m.flags = 3;
+	m.cached = true;
+	m.key = getKey(keySize);
+	return m;
+}
+
+template <>
+GetValueReply makeMessage<GetValueReply>(size_t keySize) {
+	return GetValueReply(Optional<Value>(Value(getKey(keySize))), false);
+}
+
+template <class Message>
+static void bench_serialize(benchmark::State& state) {
+	Message m = makeMessage<Message>(state.range(0));
+	for (auto _ : state) {
+		ObjectWriter writer(Unversioned());
+		writer.serialize(m);
+		benchmark::DoNotOptimize(writer.toStringRef().size());
+	}
+	state.SetItemsProcessed(static_cast<long>(state.iterations()));
+}
+
+template <class Message>
+static void bench_deserialize(benchmark::State& state) {
+	Message m = makeMessage<Message>(state.range(0));
+	Standalone<StringRef> serialized = ObjectWriter::toValue(m, Unversioned());
+	for (auto _ : state) {
+		Message result;
+		ArenaObjectReader reader(serialized.arena(), serialized, Unversioned());
+		reader.deserialize(result);
+		benchmark::DoNotOptimize(result);
+	}
+	state.SetItemsProcessed(static_cast<long>(state.iterations()));
+}
+
+BENCHMARK_TEMPLATE(bench_serialize, FixedShapeMessage)->Range(8, 1 << 10)->ReportAggregatesOnly(true);
+BENCHMARK_TEMPLATE(bench_serialize, GetValueReply)->Range(8, 1 << 10)->ReportAggregatesOnly(true);
+BENCHMARK_TEMPLATE(bench_deserialize, FixedShapeMessage)->Range(8, 1 << 10)->ReportAggregatesOnly(true);
+BENCHMARK_TEMPLATE(bench_deserialize, GetValueReply)->Range(8, 1 << 10)->ReportAggregatesOnly(true);
@@ -21,6 +21,10 @@
 #include "benchmark/benchmark.h"
 
 #include "flow/Platform.h"
+#include "flow/TimingWheel.h"
+
+#include <queue>
+#include <vector>
 
 static void bench_timer(benchmark::State& state) {
 	while (state.KeepRunning()) {
@@ -40,3 +44,63 @@ static void bench_timer_monotonic(benchmark::State& state) {
 
 BENCHMARK(bench_timer)->ReportAggregatesOnly(true);
 BENCHMARK(bench_timer_monotonic)->ReportAggregatesOnly(true);
+
+// Each iteration schedules a timeout state.range(0) milliseconds out, cancels the one scheduled half that long ago
+// (as when a reply beats its request's timeout) and advances the clock by a millisecond. The heap, like Net2's timer
+// heap used to, can't remove a cancelled timer and keeps it until it expires.
+static void bench_timer_heap(benchmark::State& state) {
+	struct Entry {
+		double at;
+		int64_t id;
+		bool operator<(Entry const& rhs) const { return at > rhs.at; }
+	};
+	int64_t n = state.range(0);
+	std::priority_queue<Entry, std::vector<Entry>> heap;
+	std::vector<bool> cancelled(n);
+	double now = 0;
+	int64_t i = 0, expired = 0;
+	for (auto _ : state) {
+		cancelled[i % n] = false;
+		heap.push(Entry{ now + n * 1e-3, i % n });
+		cancelled[(i + n / 2) % n] = true;
+		now += 1e-3;
+		++i;
+		while (!heap.empty() && heap.top().at < now) {
+			expired += !cancelled[heap.top().id];
+			heap.pop();
+		}
+		benchmark::DoNotOptimize(expired);
+	}
+	state.SetItemsProcessed(static_cast<long>(state.iterations()));
+}
+
+struct BenchTimerNode : TimingWheelNode {};
+
+static void bench_timing_wheel(benchmark::State& state) {
+	int64_t n = state.range(0);
+	TimingWheel wheel;
+	std::vector<BenchTimerNode> nodes(n);
+	double now = 0;
+	int64_t i = 0, expired = 0;
+	for (auto _ : state) {
+		BenchTimerNode& node = nodes[i % n];
+		if (node.linked()) {
+			node.unlink();
+		}
+		node.at = now + n * 1e-3;
+		wheel.insert(&node, now);
+		BenchTimerNode& cancelled = nodes[(i + n / 2) % n];
+		if (cancelled.linked()) {
+			cancelled.unlink();
+		}
+		now += 1e-3;
+		++i;
+		wheel.advance(now, [&](TimingWheelNode*) { ++expired; });
+		benchmark::DoNotOptimize(expired);
+	}
+	wheel.clear();
+	state.SetItemsProcessed(static_cast<long>(state.iterations()));
+}
+
+BENCHMARK(bench_timer_heap)->Range(1 << 10, 1 << 18)->ReportAggregatesOnly(true);
+BENCHMARK(bench_timing_wheel)->Range(1 << 10, 1 << 18)->ReportAggregatesOnly(true);
@@ -7,6 +7,7 @@ parser = argparse.ArgumentParser("Run multithreaded client tests")
 parser.add_argument("cluster_file", nargs='+', help='List of fdb.cluster files to connect to')
 parser.add_argument("--skip-so-files", default=False, action='store_true', help='Do not load .so files')
 parser.add_argument("--threads", metavar="N", type=int, default=3, help='Number of threads to use.  Zero implies local client')
+parser.add_argument("--threads-per-database", metavar="N", type=int, default=1, help='Number of threads each database is spread across')
 parser.add_argument("--build-dir", metavar="DIR", default='.', help='Path to root directory of FDB build output')
 parser.add_argument("--client-log-dir", metavar="DIR", default="client-logs", help="Path to write client logs to.  The directory will be created if it does not exist.")
 args = parser.parse_args()
@@ -18,6 +19,7 @@ import sys
 ## These should pass:
 # ../tests/loopback_cluster/run_cluster.sh . 3 '../tests/python_tests/multithreaded_client.py loopback-cluster-*/fdb.cluster'
 # ../tests/loopback_cluster/run_cluster.sh . 3 '../tests/python_tests/multithreaded_client.py loopback-cluster-*/fdb.cluster --threads 1'
+# ../tests/loopback_cluster/run_cluster.sh . 3 '../tests/python_tests/multithreaded_client.py loopback-cluster-*/fdb.cluster --threads 3 --threads-per-database 3'
 # ../tests/loopback_cluster/run_cluster.sh . 3 '../tests/python_tests/multithreaded_client.py loopback-cluster-*/fdb.cluster --threads 1 --skip-so-files'
 # ../tests/loopback_cluster/run_cluster.sh . 3 '../tests/python_tests/multithreaded_client.py loopback-cluster-*/fdb.cluster --threads 0'
 # ../tests/loopback_cluster/run_cluster.sh . 3 '../tests/python_tests/multithreaded_client.py loopback-cluster-*/fdb.cluster --threads 0 --skip-so-files'
@@ -46,6 +48,9 @@ if not args.skip_so_files:
 if args.threads > 0:
     fdb.options.set_client_threads_per_version(args.threads)
 
+if args.threads_per_database > 1:
+    fdb.options.set_client_threads_per_database(args.threads_per_database)
+
 dbs = []
 for v in args.cluster_file:
     dbs.append(fdb.open(cluster_file=v))